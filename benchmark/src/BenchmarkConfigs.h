@@ -0,0 +1,57 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Config/ConfigParser/JsonConfigParser.h"
+
+namespace Benchmarks {
+
+struct EndpointConfig {
+    std::string name;
+    std::string host;
+    uint16_t port = 0;
+    double timeoutSeconds = 1.5;
+    bool enabled = true;
+    std::vector<std::string> tags;
+};
+
+struct LargeConfig {
+    std::string service = "benchmark";
+    uint32_t revision = 1;
+    std::vector<EndpointConfig> endpoints;
+    std::map<std::string, int64_t> limits;
+};
+
+inline LargeConfig makeConfig(int64_t entries) {
+    LargeConfig config;
+    config.endpoints.reserve(static_cast<size_t>(entries));
+    for (int64_t i = 0; i < entries; ++i) {
+        config.endpoints.push_back({"endpoint_" + std::to_string(i),
+                                    "host-" + std::to_string(i % 97) + ".internal",
+                                    static_cast<uint16_t>(1024 + i % 50000),
+                                    0.25 * static_cast<double>(i % 13),
+                                    i % 3 != 0,
+                                    {"tier" + std::to_string(i % 4), "zone" + std::to_string(i % 7)}});
+        config.limits["limit_" + std::to_string(i)] = i * 31;
+    }
+    return config;
+}
+
+inline std::string makeDocument(int64_t entries) {
+    std::stringstream out;
+    Utils::Config::JsonConfigParser<LargeConfig>().writeConfig(makeConfig(entries), out);
+    return out.str();
+}
+
+inline void setThroughput(benchmark::State& state, const std::string& document) {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(document.size()));
+    state.counters["documentBytes"] = static_cast<double>(document.size());
+}
+
+}  // namespace Benchmarks
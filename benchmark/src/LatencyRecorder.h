@@ -0,0 +1,97 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Benchmarks {
+
+// Records per-operation latencies of a benchmark loop and reports their percentiles as counters (p50/p90/p99/p999,
+// in ns), taken over the samples of all the benchmark's threads together. Only one operation in sampleEvery is
+// timed, so the two clock reads stay out of most iterations and barely move the benchmark's own mean time. Each
+// sample still includes one clock read pair, reported as clock_overhead_ns.
+// Use one recorder per benchmark thread and call report() from every thread once the loop is done.
+class LatencyRecorder {
+   public:
+    static constexpr std::size_t sampleEvery = 16;
+    static constexpr std::size_t maxSamples = 1 << 20;
+
+    LatencyRecorder() { m_samples.reserve(maxSamples / sampleEvery); }
+
+    template <typename Operation>
+    void measure(Operation&& operation) {
+        if (++m_calls % sampleEvery != 0 || m_samples.size() == m_samples.capacity()) {
+            operation();
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        operation();
+        const auto end = std::chrono::steady_clock::now();
+        m_samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    // The last of the benchmark's threads to report computes the percentiles over everybody's samples
+    void report(benchmark::State& state) {
+        auto& merged = mergedSamples();
+        std::lock_guard lock(merged.mutex);
+        merged.samples.insert(merged.samples.end(), m_samples.begin(), m_samples.end());
+        m_samples.clear();
+        if (++merged.reported < state.threads()) return;
+
+        auto samples = std::move(merged.samples);
+        merged.samples.clear();
+        merged.reported = 0;
+        if (samples.empty()) return;
+
+        std::sort(samples.begin(), samples.end());
+        const auto percentile = [&](double fraction) {
+            const auto index = static_cast<std::size_t>(fraction * static_cast<double>(samples.size() - 1));
+            return benchmark::Counter(static_cast<double>(samples[index]));
+        };
+        // Only this thread sets the counters, so Google Benchmark's sum over the threads keeps them as they are
+        state.counters["p50_ns"] = percentile(0.50);
+        state.counters["p90_ns"] = percentile(0.90);
+        state.counters["p99_ns"] = percentile(0.99);
+        state.counters["p999_ns"] = percentile(0.999);
+        state.counters["clock_overhead_ns"] = benchmark::Counter(static_cast<double>(clockOverhead()));
+    }
+
+   private:
+    struct MergedSamples {
+        std::mutex mutex;
+        std::vector<int64_t> samples;
+        int reported = 0;
+    };
+
+    // Benchmarks run one after another, so a single merge area serves all of them
+    static MergedSamples& mergedSamples() {
+        static MergedSamples merged;
+        return merged;
+    }
+
+    // Median of back-to-back clock read pairs, what every sample carries on top of the operation
+    static int64_t clockOverhead() {
+        static const int64_t overhead = [] {
+            std::vector<int64_t> pairs(1001);
+            for (auto& pair : pairs) {
+                const auto start = std::chrono::steady_clock::now();
+                const auto end = std::chrono::steady_clock::now();
+                pair = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            }
+            std::nth_element(pairs.begin(), pairs.begin() + pairs.size() / 2, pairs.end());
+            return pairs[pairs.size() / 2];
+        }();
+        return overhead;
+    }
+
+    std::vector<int64_t> m_samples;
+    std::size_t m_calls = 0;
+};
+
+}  // namespace Benchmarks
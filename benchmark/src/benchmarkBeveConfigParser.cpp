@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "BenchmarkConfigs.h"
+#include "Config/ConfigParser/BeveConfigParser.h"
+#include "Config/ConfigParser/CachedConfigParser.h"
+
+namespace {
+
+using namespace Benchmarks;
+
+void BM_BeveConfigParser_StringView(benchmark::State& state) {
+    std::stringstream out;
+    const Utils::Config::BeveConfigParser<LargeConfig> parser;
+    parser.writeConfig(makeConfig(state.range(0)), out);
+    const std::string document = out.str();
+
+    for (auto _ : state) {
+        auto config = parser.readConfig(std::string_view(document));
+        benchmark::DoNotOptimize(config);
+    }
+    setThroughput(state, document);
+}
+
+// Cold start through the snapshot cache: map + hash the JSON, then load the BEVE snapshot
+void BM_CachedConfigParser_SnapshotHit(benchmark::State& state) {
+    const std::string document = makeDocument(state.range(0));
+    const auto path = std::filesystem::temp_directory_path() /
+                      ("benchmarkCachedConfigParser_" + std::to_string(state.range(0)) + ".json");
+    std::ofstream(path, std::ios::binary) << document;
+
+    const Utils::Config::CachedConfigParser<LargeConfig> parser;
+    parser.compileSnapshot(path);
+    for (auto _ : state) {
+        auto config = parser.readConfigFile(path);
+        benchmark::DoNotOptimize(config);
+    }
+    setThroughput(state, document);
+    std::filesystem::remove(path);
+    std::filesystem::remove(Utils::Config::snapshotPathFor(path));
+}
+
+void BM_ConfigSnapshot_Hash(benchmark::State& state) {
+    const std::string document = makeDocument(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Utils::Config::hashConfigSource(document));
+    }
+    setThroughput(state, document);
+}
+
+}  // namespace
+
+BENCHMARK(BM_BeveConfigParser_StringView)->RangeMultiplier(16)->Range(16, 65536)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CachedConfigParser_SnapshotHit)->RangeMultiplier(16)->Range(16, 65536)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ConfigSnapshot_Hash)->RangeMultiplier(16)->Range(16, 65536)->Unit(benchmark::kMicrosecond);
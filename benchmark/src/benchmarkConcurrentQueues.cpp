@@ -0,0 +1,170 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "Concurrency/BlockingQueue.h"
+#include "Concurrency/MPMCQueue.h"
+#include "Concurrency/MPSCQueue.h"
+#include "Concurrency/SPSCQueue.h"
+#include "LatencyRecorder.h"
+
+namespace {
+
+using namespace Benchmarks;
+using namespace Utils::Concurrency;
+
+constexpr std::size_t queueCapacity = 1024;
+
+// Baseline the lock-free rings are compared against
+class LockedQueue {
+   public:
+    using value_type = uint64_t;
+
+    explicit LockedQueue(std::size_t capacity) : m_capacity(capacity) {}
+
+    bool tryPush(uint64_t value) {
+        std::lock_guard lock(m_mutex);
+        if (m_queue.size() == m_capacity) return false;
+        m_queue.push(value);
+        return true;
+    }
+
+    bool tryPop(uint64_t& out) {
+        std::lock_guard lock(m_mutex);
+        if (m_queue.empty()) return false;
+        out = m_queue.front();
+        m_queue.pop();
+        return true;
+    }
+
+   private:
+    const std::size_t m_capacity;
+    std::mutex m_mutex;
+    std::queue<uint64_t> m_queue;
+};
+
+// Yielding keeps the benchmarks usable on machines with fewer cores than benchmark threads
+template <typename Queue>
+void push(Queue& queue, uint64_t value) {
+    while (!queue.tryPush(value)) std::this_thread::yield();
+}
+
+template <typename Queue>
+uint64_t pop(Queue& queue) {
+    uint64_t value = 0;
+    while (!queue.tryPop(value)) std::this_thread::yield();
+    return value;
+}
+
+// Throughput with half of the benchmark threads producing and half consuming
+template <typename Queue>
+void BM_Queue_Throughput(benchmark::State& state) {
+    static std::unique_ptr<Queue> queue;
+    if (state.thread_index() == 0) {
+        queue = std::make_unique<Queue>(queueCapacity);
+    }
+
+    const bool producer = state.thread_index() % 2 == 0;
+    uint64_t value = 0;
+    for (auto _ : state) {
+        if (producer) {
+            push(*queue, ++value);
+        } else {
+            benchmark::DoNotOptimize(pop(*queue));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0) {
+        queue.reset();
+    }
+}
+
+// Thread 0 drains everything the other threads produce
+template <typename Queue>
+void BM_Queue_FanIn(benchmark::State& state) {
+    static std::unique_ptr<Queue> queue;
+    if (state.thread_index() == 0) {
+        queue = std::make_unique<Queue>(queueCapacity);
+    }
+
+    const auto producers = state.threads() - 1;
+    uint64_t value = 0;
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            for (int i = 0; i < producers; ++i) benchmark::DoNotOptimize(pop(*queue));
+        } else {
+            push(*queue, ++value);
+        }
+    }
+    if (state.thread_index() == 0) {
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * producers);
+        queue.reset();
+    }
+}
+
+// Round trip through a pair of queues and an echo thread
+template <typename Queue>
+void BM_Queue_PingPong(benchmark::State& state) {
+    Queue requests(queueCapacity);
+    Queue responses(queueCapacity);
+    std::jthread echo([&](std::stop_token token) {
+        uint64_t value = 0;
+        while (!token.stop_requested()) {
+            if (requests.tryPop(value)) {
+                push(responses, value);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    LatencyRecorder recorder;
+    uint64_t value = 0;
+    for (auto _ : state) {
+        recorder.measure([&] {
+            push(requests, ++value);
+            benchmark::DoNotOptimize(pop(responses));
+        });
+    }
+    recorder.report(state);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+void BM_BlockingQueue_PingPong(benchmark::State& state) {
+    using Queue = BlockingQueue<SPSCQueue<uint64_t>>;
+    Queue requests(queueCapacity);
+    Queue responses(queueCapacity);
+    std::jthread echo([&] {
+        // Zero is the stop message
+        while (const auto value = requests.pop()) responses.push(value);
+    });
+
+    LatencyRecorder recorder;
+    uint64_t value = 0;
+    for (auto _ : state) {
+        recorder.measure([&] {
+            requests.push(++value);
+            benchmark::DoNotOptimize(responses.pop());
+        });
+    }
+    requests.push(0);
+    recorder.report(state);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_Queue_Throughput<SPSCQueue<uint64_t>>)->Threads(2)->UseRealTime();
+BENCHMARK(BM_Queue_Throughput<MPMCQueue<uint64_t>>)->ThreadRange(2, 8)->UseRealTime();
+BENCHMARK(BM_Queue_Throughput<LockedQueue>)->ThreadRange(2, 8)->UseRealTime();
+BENCHMARK(BM_Queue_FanIn<MPSCQueue<uint64_t>>)->ThreadRange(2, 8)->UseRealTime();
+BENCHMARK(BM_Queue_FanIn<MPMCQueue<uint64_t>>)->ThreadRange(2, 8)->UseRealTime();
+BENCHMARK(BM_Queue_FanIn<LockedQueue>)->ThreadRange(2, 8)->UseRealTime();
+BENCHMARK(BM_Queue_PingPong<SPSCQueue<uint64_t>>)->UseRealTime();
+BENCHMARK(BM_Queue_PingPong<MPMCQueue<uint64_t>>)->UseRealTime();
+BENCHMARK(BM_BlockingQueue_PingPong)->UseRealTime();
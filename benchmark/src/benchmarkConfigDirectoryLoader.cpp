@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "BenchmarkConfigs.h"
+#include "Config/ConfigDirectoryLoader.h"
+#include "Config/ConfigParser/MappedFile.h"
+
+namespace {
+
+using namespace Benchmarks;
+
+constexpr int fileCount = 32;
+
+std::string writeConfigDirectory(const std::filesystem::path& directory) {
+    std::filesystem::create_directories(directory);
+    std::string document = makeDocument(2048);
+    for (int i = 0; i < fileCount; ++i) {
+        std::ofstream(directory / ("config_" + std::to_string(10 + i) + ".json"), std::ios::binary) << document;
+    }
+    return document;
+}
+
+void BM_ConfigDirectoryLoader_Load(benchmark::State& state) {
+    const auto directory = std::filesystem::temp_directory_path() / "benchmarkConfigDirectoryLoader";
+    const std::string document = writeConfigDirectory(directory);
+
+    const Utils::Config::ConfigDirectoryLoader<LargeConfig> loader(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto config = loader.load(directory);
+        benchmark::DoNotOptimize(config);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * fileCount *
+                            static_cast<int64_t>(document.size()));
+    std::filesystem::remove_all(directory);
+}
+
+// Reference for the loader: every file parsed with glaze one after another into the same struct, on one thread
+void BM_ConfigDirectoryLoader_SequentialParse(benchmark::State& state) {
+    const auto directory = std::filesystem::temp_directory_path() / "benchmarkConfigDirectoryLoaderSequential";
+    const std::string document = writeConfigDirectory(directory);
+
+    for (auto _ : state) {
+        LargeConfig config;
+        for (const auto& file : Utils::Config::ConfigDirectoryLoader<LargeConfig>::listConfigFiles(directory)) {
+            const Utils::Config::MappedFile json(file);
+            if (glz::read<glz::opts{.null_terminated = false}>(config, json.view())) {
+                state.SkipWithError("parse failed");
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(config);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * fileCount *
+                            static_cast<int64_t>(document.size()));
+    std::filesystem::remove_all(directory);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ConfigDirectoryLoader_Load)
+    ->ArgName("threads")
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_ConfigDirectoryLoader_SequentialParse)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include "Config/IConfigProvider.h"
+#include "Config/VersionedConfigPublisher.h"
+#include "LatencyRecorder.h"
+
+namespace {
+
+using namespace Benchmarks;
+
+struct ProviderConfig {
+    std::string name = "provider";
+    int value = 42;
+};
+
+// getConfig() under contention, readers only
+template <typename Provider>
+void BM_ConfigProvider_GetConfig(benchmark::State& state) {
+    static Provider provider;
+    if (state.thread_index() == 0) {
+        provider.setConfig(std::make_shared<ProviderConfig>());
+    }
+
+    LatencyRecorder recorder;
+    for (auto _ : state) {
+        recorder.measure([&] { benchmark::DoNotOptimize(provider.getConfig()); });
+    }
+    recorder.report(state);
+}
+
+// getConfig() while thread 0 keeps replacing the config
+template <typename Provider>
+void BM_ConfigProvider_GetConfigDuringUpdates(benchmark::State& state) {
+    static Provider provider;
+    if (state.thread_index() == 0) {
+        provider.setConfig(std::make_shared<ProviderConfig>());
+    }
+
+    LatencyRecorder recorder;
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            provider.setConfig(std::make_shared<ProviderConfig>());
+        } else {
+            recorder.measure([&] { benchmark::DoNotOptimize(provider.getConfig()); });
+        }
+    }
+    recorder.report(state);
+}
+
+using MutexProvider = Utils::Config::IConfigProvider<ProviderConfig>;
+using VersionedProvider = Utils::Config::VersionedConfigPublisher<ProviderConfig>;
+
+}  // namespace
+
+BENCHMARK(BM_ConfigProvider_GetConfig<MutexProvider>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_ConfigProvider_GetConfig<VersionedProvider>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_ConfigProvider_GetConfigDuringUpdates<MutexProvider>)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK(BM_ConfigProvider_GetConfigDuringUpdates<VersionedProvider>)->ThreadRange(2, 16)->UseRealTime();
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "BenchmarkConfigs.h"
+#include "Config/ConfigParser/JsonConfigParser.h"
+
+namespace {
+
+using namespace Benchmarks;
+
+// The parse path JsonConfigParser used before string_view/file overloads existed, kept as the comparison baseline
+std::shared_ptr<LargeConfig> legacyReadConfig(std::istream& jsonStream) {
+    std::string json((std::istreambuf_iterator<char>(jsonStream)), std::istreambuf_iterator<char>());
+
+    LargeConfig config;
+    if (glz::read_json(config, json)) {
+        return nullptr;
+    }
+    return std::make_shared<LargeConfig>(config);
+}
+
+void BM_JsonConfigParser_LegacyStream(benchmark::State& state) {
+    const std::string document = makeDocument(state.range(0));
+    for (auto _ : state) {
+        std::istringstream stream(document);
+        auto config = legacyReadConfig(stream);
+        benchmark::DoNotOptimize(config);
+    }
+    setThroughput(state, document);
+}
+
+void BM_JsonConfigParser_Stream(benchmark::State& state) {
+    const std::string document = makeDocument(state.range(0));
+    const Utils::Config::JsonConfigParser<LargeConfig> parser;
+    for (auto _ : state) {
+        std::istringstream stream(document);
+        auto config = parser.readConfig(stream);
+        benchmark::DoNotOptimize(config);
+    }
+    setThroughput(state, document);
+}
+
+void BM_JsonConfigParser_StringView(benchmark::State& state) {
+    const std::string document = makeDocument(state.range(0));
+    const Utils::Config::JsonConfigParser<LargeConfig> parser;
+    for (auto _ : state) {
+        auto config = parser.readConfig(std::string_view(document));
+        benchmark::DoNotOptimize(config);
+    }
+    setThroughput(state, document);
+}
+
+void BM_JsonConfigParser_MappedFile(benchmark::State& state) {
+    const std::string document = makeDocument(state.range(0));
+    const auto path = std::filesystem::temp_directory_path() /
+                      ("benchmarkJsonConfigParser_" + std::to_string(state.range(0)) + ".json");
+    std::ofstream(path, std::ios::binary) << document;
+
+    const Utils::Config::JsonConfigParser<LargeConfig> parser;
+    for (auto _ : state) {
+        auto config = parser.readConfigFile(path);
+        benchmark::DoNotOptimize(config);
+    }
+    setThroughput(state, document);
+    std::filesystem::remove(path);
+}
+
+}  // namespace
+
+// 16 entries is ~2KB, 65536 entries is several MB
+BENCHMARK(BM_JsonConfigParser_LegacyStream)->RangeMultiplier(16)->Range(16, 65536)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_JsonConfigParser_Stream)->RangeMultiplier(16)->Range(16, 65536)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_JsonConfigParser_StringView)->RangeMultiplier(16)->Range(16, 65536)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_JsonConfigParser_MappedFile)->RangeMultiplier(16)->Range(16, 65536)->Unit(benchmark::kMicrosecond);
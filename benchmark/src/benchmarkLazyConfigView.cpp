@@ -0,0 +1,36 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "BenchmarkConfigs.h"
+#include "Config/ConfigParser/LazyConfigView.h"
+
+namespace {
+
+using namespace Benchmarks;
+
+// Cold view per iteration: index the path to one endpoint and deserialize only that sub-tree
+void BM_LazyConfigView_SingleSubTree(benchmark::State& state) {
+    const std::string document = makeDocument(state.range(0));
+    const std::string pointer = "/endpoints/" + std::to_string(state.range(0) / 2);
+    for (auto _ : state) {
+        Utils::Config::LazyConfigView view{std::string(document)};
+        auto endpoint = view.get<EndpointConfig>(pointer);
+        benchmark::DoNotOptimize(endpoint);
+    }
+    setThroughput(state, document);
+}
+
+void BM_LazyConfigView_CachedGet(benchmark::State& state) {
+    Utils::Config::LazyConfigView view{makeDocument(state.range(0))};
+    view.get<EndpointConfig>("/endpoints/0");
+    for (auto _ : state) {
+        auto endpoint = view.get<EndpointConfig>("/endpoints/0");
+        benchmark::DoNotOptimize(endpoint);
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_LazyConfigView_SingleSubTree)->RangeMultiplier(16)->Range(16, 65536)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_LazyConfigView_CachedGet)->Arg(4096);
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/sinks/null_sink.h>
+
+#include <filesystem>
+#include <memory>
+
+#include "LatencyRecorder.h"
+#include "Logging/Logger.h"
+
+namespace {
+
+using namespace Benchmarks;
+
+std::unique_ptr<Utils::Logging::Logger> makeLogger(Utils::Logging::LogLevel level, bool batching = false) {
+    auto config = std::make_shared<Utils::Logging::LoggerConfig>();
+    config->globalLogLevel = level;
+    config->batching = batching;
+    config->filename = (std::filesystem::temp_directory_path() / "benchmarkLogging.txt").string();
+
+    // Sinks write into the void so only the logging front-end is measured
+    auto logger = std::make_unique<Utils::Logging::Logger>("Benchmark", config);
+    logger->clearSinks();
+    logger->addSink(std::make_shared<spdlog::sinks::null_sink_mt>());
+    return logger;
+}
+
+void BM_Logging_Enabled(benchmark::State& state) {
+    static std::unique_ptr<Utils::Logging::Logger> logger;
+    if (state.thread_index() == 0) {
+        logger = makeLogger(Utils::Logging::LogLevel::INFO);
+    }
+
+    LatencyRecorder recorder;
+    int64_t counter = 0;
+    for (auto _ : state) {
+        recorder.measure([&] {
+            logger->log<Utils::Logging::LogLevel::INFO>(
+                fmt::format("Enabled message {} with payload {}", ++counter, 3.14));
+        });
+    }
+    recorder.report(state);
+}
+
+// Same records through per-thread staging buffers, the writer thread drains them into the sinks
+void BM_Logging_Batched(benchmark::State& state) {
+    static std::unique_ptr<Utils::Logging::Logger> logger;
+    if (state.thread_index() == 0) {
+        logger = makeLogger(Utils::Logging::LogLevel::INFO, true);
+    }
+
+    LatencyRecorder recorder;
+    int64_t counter = 0;
+    for (auto _ : state) {
+        recorder.measure([&] {
+            logger->log<Utils::Logging::LogLevel::INFO>(
+                fmt::format("Enabled message {} with payload {}", ++counter, 3.14));
+        });
+    }
+    recorder.report(state);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0) {
+        logger.reset();
+    }
+}
+
+// Filtered out by level: measures what a disabled record still costs at the call site
+void BM_Logging_Disabled(benchmark::State& state) {
+    static std::unique_ptr<Utils::Logging::Logger> logger;
+    if (state.thread_index() == 0) {
+        logger = makeLogger(Utils::Logging::LogLevel::INFO);
+    }
+
+    LatencyRecorder recorder;
+    int64_t counter = 0;
+    for (auto _ : state) {
+        recorder.measure([&] {
+            logger->log<Utils::Logging::LogLevel::DEBUG>(
+                fmt::format("Disabled message {} with payload {}", ++counter, 3.14));
+        });
+    }
+    recorder.report(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_Logging_Enabled)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_Logging_Batched)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_Logging_Disabled)->ThreadRange(1, 8)->UseRealTime();
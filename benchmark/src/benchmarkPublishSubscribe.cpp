@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Concurrency/WorkStealingExecutor.h"
+#include "LatencyRecorder.h"
+#include "PublishSubscribe/IPublisherSubscriber.h"
+
+namespace {
+
+using namespace Benchmarks;
+
+struct BenchmarkMessage {
+    uint64_t sequence = 0;
+};
+
+class CountingSubscriber : public Utils::PublishSubscribe::ISubscriber<BenchmarkMessage> {
+   public:
+    void onUpdate(const BenchmarkMessage& message) override {
+        m_received.fetch_add(1, std::memory_order_relaxed);
+        benchmark::DoNotOptimize(message.sequence);
+    }
+
+   private:
+    std::atomic<uint64_t> m_received{0};
+};
+
+class BenchmarkPublisher : public Utils::PublishSubscribe::IPublisher<BenchmarkMessage> {
+   public:
+    void send(const BenchmarkMessage& message) { publish(message); }
+};
+
+// publishMessage() fan-out: range(0) subscribers, benchmark threads publishing concurrently
+void BM_PublishSubscribe_FanOut(benchmark::State& state) {
+    static std::vector<std::unique_ptr<CountingSubscriber>> subscribers;
+    if (state.thread_index() == 0) {
+        subscribers.clear();
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            subscribers.push_back(std::make_unique<CountingSubscriber>());
+        }
+    }
+
+    BenchmarkPublisher publisher;
+    LatencyRecorder recorder;
+    BenchmarkMessage message;
+    for (auto _ : state) {
+        ++message.sequence;
+        recorder.measure([&] { publisher.send(message); });
+    }
+    recorder.report(state);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+
+    if (state.thread_index() == 0) {
+        subscribers.clear();
+    }
+}
+
+struct SkewedMessage {
+    uint64_t sequence = 0;
+};
+
+// Burns `cost` iterations per message; a few subscribers are much more expensive than the rest
+class SkewedSubscriber : public Utils::PublishSubscribe::ISubscriber<SkewedMessage> {
+   public:
+    explicit SkewedSubscriber(uint64_t cost) : m_cost(cost) {}
+
+    void onUpdate(const SkewedMessage& message) override {
+        uint64_t value = message.sequence;
+        for (uint64_t i = 0; i < m_cost; ++i) {
+            value = value * 6364136223846793005ull + 1442695040888963407ull;
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+   private:
+    const uint64_t m_cost;
+};
+
+class SkewedPublisher : public Utils::PublishSubscribe::IPublisher<SkewedMessage> {
+   public:
+    void send(const SkewedMessage& message) { publish(message); }
+};
+
+enum class Delivery { Inline, StaticPartition, WorkStealing, WorkStealingOrdered };
+
+// range(0) subscribers, every 16th one 64x more expensive, all of them packed at the front so that a static split
+// over the workers hands them to the same thread. range(1) selects the Delivery mode.
+void BM_PublishSubscribe_SkewedFanOut(benchmark::State& state) {
+    constexpr uint64_t baseCost = 200;
+    const auto subscriberCount = static_cast<size_t>(state.range(0));
+    const auto delivery = static_cast<Delivery>(state.range(1));
+
+    std::vector<std::unique_ptr<SkewedSubscriber>> subscribers;
+    for (size_t i = 0; i < subscriberCount; ++i) {
+        const bool expensive = i < subscriberCount / 16;
+        subscribers.push_back(std::make_unique<SkewedSubscriber>(expensive ? baseCost * 64 : baseCost));
+    }
+
+    auto* manager = Utils::PublishSubscribe::PublishSubscribeManager<SkewedMessage>::getManager();
+    auto executor = std::make_shared<Utils::Concurrency::WorkStealingExecutor>();
+    if (delivery == Delivery::WorkStealing || delivery == Delivery::WorkStealingOrdered) {
+        manager->setExecutor(executor, delivery == Delivery::WorkStealingOrdered);
+    }
+
+    SkewedPublisher publisher;
+    SkewedMessage message;
+    const auto workers = executor->getThreadCount();
+    for (auto _ : state) {
+        ++message.sequence;
+        if (delivery != Delivery::StaticPartition) {
+            publisher.send(message);
+            continue;
+        }
+
+        // One contiguous chunk of subscribers per worker, no stealing between chunks
+        Utils::Concurrency::TaskGroup group;
+        const auto chunk = (subscriberCount + workers - 1) / workers;
+        for (size_t begin = 0; begin < subscriberCount; begin += chunk) {
+            executor->submit(group, [&, begin] {
+                for (size_t i = begin; i < std::min(begin + chunk, subscriberCount); ++i) {
+                    subscribers[i]->onUpdate(message);
+                }
+            });
+        }
+        executor->wait(group);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+
+    manager->setExecutor(nullptr);
+}
+
+}  // namespace
+
+BENCHMARK(BM_PublishSubscribe_SkewedFanOut)
+    ->ArgNames({"subscribers", "delivery"})
+    ->ArgsProduct({{64, 512}, {0, 1, 2, 3}})
+    ->UseRealTime();
+
+BENCHMARK(BM_PublishSubscribe_FanOut)
+    ->ArgName("subscribers")
+    ->RangeMultiplier(8)
+    ->Range(1, 512)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
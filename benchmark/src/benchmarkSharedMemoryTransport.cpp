@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+
+#include "Concurrency/SharedMemoryChannel.h"
+#include "LatencyRecorder.h"
+
+namespace {
+
+using namespace Benchmarks;
+using Utils::Concurrency::SharedMemoryChannel;
+
+std::string channelName(const std::string& benchmark) {
+    return "UtilsBenchmark." + benchmark + "." + std::to_string(getpid());
+}
+
+std::span<const std::byte> bytesOf(const uint64_t& value) { return std::as_bytes(std::span(&value, 1)); }
+
+// One writer, a reader thread draining the ring as fast as it can
+void BM_SharedMemory_Throughput(benchmark::State& state) {
+    auto channel = SharedMemoryChannel::create(channelName("Throughput"), {.slotCount = 4096, .slotSize = 64});
+    if (!channel) {
+        state.SkipWithError("cannot create shared memory channel");
+        return;
+    }
+    auto reader = channel->subscribe();
+    std::jthread drain([&](std::stop_token token) {
+        while (!token.stop_requested()) benchmark::DoNotOptimize(reader->read(std::chrono::milliseconds(10)));
+    });
+
+    uint64_t value = 0;
+    for (auto _ : state) {
+        channel->write(bytesOf(++value));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Round trip to an echo process and back, two channels, one per direction
+void BM_SharedMemory_PingPong(benchmark::State& state) {
+    const auto requestName = channelName("Ping");
+    const auto responseName = channelName("Pong");
+    auto requests = SharedMemoryChannel::create(requestName, {.slotCount = 64, .slotSize = 64});
+    auto responses = SharedMemoryChannel::create(responseName, {.slotCount = 64, .slotSize = 64});
+    if (!requests || !responses) {
+        state.SkipWithError("cannot create shared memory channels");
+        return;
+    }
+    auto replies = responses->subscribe();
+
+    // The echo process subscribes before it acknowledges with 0 and leaves on 0
+    const pid_t child = fork();
+    if (child == 0) {
+        auto in = SharedMemoryChannel::open(requestName);
+        auto out = SharedMemoryChannel::open(responseName);
+        auto incoming = in ? in->subscribe() : nullptr;
+        if (!incoming || !out) _exit(1);
+
+        out->write(bytesOf(0));
+        for (;;) {
+            const auto message = incoming->read(std::chrono::seconds(1));
+            if (!message) continue;
+            out->write(message->payload);
+            if (std::to_integer<int>(message->payload[0]) == 0) _exit(0);
+        }
+    }
+    if (child < 0 || !replies->read(std::chrono::seconds(5))) {
+        state.SkipWithError("echo process did not start");
+        return;
+    }
+
+    LatencyRecorder recorder;
+    uint64_t value = 0;
+    for (auto _ : state) {
+        // Low byte never 0, that is the stop message
+        value = (value + 1) | 1;
+        recorder.measure([&] {
+            requests->write(bytesOf(value));
+            benchmark::DoNotOptimize(replies->read(std::chrono::seconds(5)));
+        });
+    }
+    recorder.report(state);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    requests->write(bytesOf(0));
+    waitpid(child, nullptr, 0);
+}
+
+}  // namespace
+
+BENCHMARK(BM_SharedMemory_Throughput)->UseRealTime();
+BENCHMARK(BM_SharedMemory_PingPong)->UseRealTime();
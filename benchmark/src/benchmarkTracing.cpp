@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+
+#include "Logging/TracingMacros.h"
+
+namespace {
+
+// Cost of an empty traced scope: two clock reads plus the thread-local histogram update
+void BM_Tracing_Scope(benchmark::State& state) {
+    for (auto _ : state) {
+        TRACE_SCOPE("benchmarkTracing.scope");
+        benchmark::ClobberMemory();
+    }
+}
+
+void BM_Tracing_ScopeWithEvents(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        Utils::Logging::Tracer::enableTraceEvents();
+    }
+    for (auto _ : state) {
+        TRACE_SCOPE("benchmarkTracing.scopeWithEvents");
+        benchmark::ClobberMemory();
+    }
+    if (state.thread_index() == 0) {
+        Utils::Logging::Tracer::disableTraceEvents();
+    }
+}
+
+void BM_Tracing_ClockRead(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Utils::Logging::TraceClock::now());
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_Tracing_Scope)->ThreadRange(1, 8);
+BENCHMARK(BM_Tracing_ScopeWithEvents)->ThreadRange(1, 8);
+BENCHMARK(BM_Tracing_ClockRead);
@@ -0,0 +1,105 @@
+// Compares a Google Benchmark JSON report against a stored baseline and fails when any benchmark got slower than
+// the allowed threshold. Usage: UtilsBenchmarksCompare <results.json> <baseline.json> [threshold, default 0.10]
+// Exits with 77, which CTest reports as skipped, when no baseline has been recorded yet.
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Config/ConfigParser/MappedFile.h"
+#include "glaze/glaze.hpp"
+
+namespace {
+
+constexpr int exitSkipped = 77;
+
+struct BenchmarkResult {
+    std::string name;
+    std::string run_type;
+    double real_time = 0.0;
+    std::string time_unit = "ns";
+    bool error_occurred = false;
+};
+
+struct BenchmarkReport {
+    std::vector<BenchmarkResult> benchmarks;
+};
+
+double toNanoseconds(const BenchmarkResult& result) {
+    if (result.time_unit == "us") return result.real_time * 1e3;
+    if (result.time_unit == "ms") return result.real_time * 1e6;
+    if (result.time_unit == "s") return result.real_time * 1e9;
+    return result.real_time;
+}
+
+bool readReport(const char* path, BenchmarkReport& report) {
+    const Utils::Config::MappedFile file(path);
+    if (!file.isOpen()) return false;
+
+    auto ec = glz::read<glz::opts{.null_terminated = false, .error_on_unknown_keys = false}>(report, file.view());
+    if (ec) {
+        std::cerr << "Error reading benchmark report " << path << ": " << glz::format_error(ec, file.view())
+                  << std::endl;
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <results.json> <baseline.json> [threshold]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const double threshold = argc > 3 ? std::strtod(argv[3], nullptr) : 0.10;
+
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(argv[2], ec)) {
+        std::cout << "SKIPPED: no benchmark baseline at " << argv[2]
+                  << ", record one on the reference machine with the update_benchmark_baseline target" << std::endl;
+        return exitSkipped;
+    }
+
+    BenchmarkReport results;
+    BenchmarkReport baseline;
+    if (!readReport(argv[1], results) || !readReport(argv[2], baseline)) return EXIT_FAILURE;
+
+    std::unordered_map<std::string_view, double> baselineTimes;
+    for (const auto& result : baseline.benchmarks) {
+        if (result.run_type == "iteration" && !result.error_occurred) {
+            baselineTimes[result.name] = toNanoseconds(result);
+        }
+    }
+
+    int regressions = 0;
+    for (const auto& result : results.benchmarks) {
+        if (result.run_type != "iteration") continue;
+        if (result.error_occurred) {
+            std::cerr << "ERROR      " << result.name << std::endl;
+            ++regressions;
+            continue;
+        }
+
+        const auto it = baselineTimes.find(result.name);
+        if (it == baselineTimes.end() || it->second <= 0.0) {
+            std::cout << "NEW        " << result.name << std::endl;
+            continue;
+        }
+
+        const double change = toNanoseconds(result) / it->second - 1.0;
+        const bool regressed = change > threshold;
+        std::cout << (regressed ? "REGRESSION " : "OK         ") << result.name << " " << change * 100.0 << "%"
+                  << std::endl;
+        regressions += regressed ? 1 : 0;
+    }
+
+    if (regressions > 0) {
+        std::cerr << regressions << " benchmark(s) regressed by more than " << threshold * 100.0 << "%" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,19 @@
+# utils_add_config_compiler(<target> HEADER <header> TYPE <type> [LINK <libraries>...])
+#
+# Adds an executable that compiles JSON configs of <type> (declared in <header>) into the binary BEVE snapshots
+# loaded by Utils::Config::CachedConfigParser: "<target> config.json" writes "config.json.beve".
+set(_UTILS_CONFIG_COMPILER_TEMPLATE "${CMAKE_CURRENT_LIST_DIR}/ConfigCompilerMain.cpp.in")
+
+function(utils_add_config_compiler TARGET)
+    cmake_parse_arguments(ARG "" "HEADER;TYPE" "LINK" ${ARGN})
+    if(NOT ARG_HEADER OR NOT ARG_TYPE)
+        message(FATAL_ERROR "utils_add_config_compiler(${TARGET}) requires HEADER and TYPE")
+    endif()
+
+    set(UTILS_CONFIG_HEADER ${ARG_HEADER})
+    set(UTILS_CONFIG_TYPE ${ARG_TYPE})
+    configure_file(${_UTILS_CONFIG_COMPILER_TEMPLATE} ${CMAKE_CURRENT_BINARY_DIR}/${TARGET}.cpp @ONLY)
+
+    add_executable(${TARGET} ${CMAKE_CURRENT_BINARY_DIR}/${TARGET}.cpp)
+    target_link_libraries(${TARGET} PRIVATE Utils::Config ${ARG_LINK})
+endfunction()
@@ -0,0 +1,106 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "CacheLine.h"
+
+namespace Utils::Concurrency {
+
+// Adds blocking push()/pop() on top of one of the lock-free rings. A thread that finds the ring full (empty) spins
+// briefly, then sleeps in std::atomic::wait on a counter bumped by the opposite side. Counters are only notified
+// while somebody sleeps, so the uncontended path stays free of syscalls.
+template <typename Queue>
+class BlockingQueue {
+   public:
+    using value_type = typename Queue::value_type;
+
+    explicit BlockingQueue(std::size_t capacity) : m_queue(capacity) {}
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        // Arguments are forwarded once into a local so that a failed attempt cannot consume them
+        value_type value(std::forward<Args>(args)...);
+        push(std::move(value));
+    }
+
+    void push(value_type value) {
+        for (;;) {
+            for (int spin = 0; spin < s_spinCount; ++spin) {
+                if (tryPush(std::move(value))) return;
+            }
+
+            const auto popped = m_popped.counter.load();
+            if (tryPush(std::move(value))) return;
+
+            m_popped.waiting.fetch_add(1);
+            m_popped.counter.wait(popped);
+            m_popped.waiting.fetch_sub(1);
+        }
+    }
+
+    value_type pop() {
+        value_type value;
+        for (;;) {
+            for (int spin = 0; spin < s_spinCount; ++spin) {
+                if (tryPop(value)) return value;
+            }
+
+            const auto pushed = m_pushed.counter.load();
+            if (tryPop(value)) return value;
+
+            m_pushed.waiting.fetch_add(1);
+            m_pushed.counter.wait(pushed);
+            m_pushed.waiting.fetch_sub(1);
+        }
+    }
+
+    bool tryPush(value_type&& value) {
+        if (!m_queue.tryPush(std::move(value))) return false;
+        m_pushed.signal();
+        return true;
+    }
+
+    bool tryPush(const value_type& value) {
+        if (!m_queue.tryPush(value)) return false;
+        m_pushed.signal();
+        return true;
+    }
+
+    bool tryPop(value_type& out) {
+        if (!m_queue.tryPop(out)) return false;
+        m_popped.signal();
+        return true;
+    }
+
+    std::size_t size() const { return m_queue.size(); }
+    bool empty() const { return m_queue.empty(); }
+    std::size_t capacity() const { return m_queue.capacity(); }
+
+   private:
+    // Sequentially consistent on purpose: a sleeper increments `waiting` before re-checking `counter` in wait(),
+    // a signaller bumps `counter` before reading `waiting`, so at least one of them observes the other.
+    struct alignas(cacheLineSize) Event {
+        void signal() {
+            counter.fetch_add(1);
+            if (waiting.load() != 0) counter.notify_all();
+        }
+
+        std::atomic<std::uint32_t> counter{0};
+        std::atomic<std::uint32_t> waiting{0};
+    };
+
+    static constexpr int s_spinCount = 64;
+
+    Queue m_queue;
+    Event m_pushed;
+    Event m_popped;
+};
+
+}  // namespace Utils::Concurrency
@@ -0,0 +1,22 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+
+namespace Utils::Concurrency {
+
+// Fixed instead of std::hardware_destructive_interference_size, whose value may differ between translation units
+// compiled with different flags and which GCC warns about when used in headers
+#if defined(__APPLE__) && defined(__aarch64__)
+inline constexpr std::size_t cacheLineSize = 128;
+#else
+inline constexpr std::size_t cacheLineSize = 64;
+#endif
+
+inline constexpr std::size_t roundUpToPowerOfTwo(std::size_t value) { return value < 2 ? 2 : std::bit_ceil(value); }
+
+}  // namespace Utils::Concurrency
@@ -0,0 +1,122 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "CacheLine.h"
+
+namespace Utils::Concurrency {
+
+// Bounded multi-producer multi-consumer ring (D. Vyukov's sequenced slots). Every slot carries a sequence number
+// telling whose turn it is, so producers and consumers only contend on their own index and never on each other.
+// Slots are padded to a cache line to keep neighbouring writers from false sharing.
+// With SingleConsumer the head index is advanced with a plain store instead of a CAS, see MPSCQueue.
+template <typename T, bool SingleConsumer = false>
+class MPMCQueue {
+   public:
+    using value_type = T;
+
+    explicit MPMCQueue(std::size_t capacity)
+        : m_mask(roundUpToPowerOfTwo(capacity) - 1), m_slots(std::make_unique<Slot[]>(m_mask + 1)) {
+        for (std::size_t i = 0; i <= m_mask; ++i) m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    ~MPMCQueue() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            const auto tail = m_tail.load(std::memory_order_acquire);
+            for (auto head = m_head.load(std::memory_order_relaxed); head != tail; ++head) {
+                m_slots[head & m_mask].get()->~T();
+            }
+        }
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    template <typename... Args>
+    bool tryEmplace(Args&&... args) {
+        auto pos = m_tail.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &m_slots[pos & m_mask];
+            const auto sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (slot->storage) T(std::forward<Args>(args)...);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(const T& value) { return tryEmplace(value); }
+    bool tryPush(T&& value) { return tryEmplace(std::move(value)); }
+
+    bool tryPop(T& out) {
+        auto pos = m_head.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &m_slots[pos & m_mask];
+            const auto sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if constexpr (SingleConsumer) {
+                    m_head.store(pos + 1, std::memory_order_relaxed);
+                    break;
+                } else if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* value = slot->get();
+        out = std::move(*value);
+        value->~T();
+        slot->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called concurrently with push/pop
+    std::size_t size() const {
+        const auto head = m_head.load(std::memory_order_acquire);
+        const auto tail = m_tail.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+    std::size_t capacity() const { return m_mask + 1; }
+
+   private:
+    struct alignas(cacheLineSize) Slot {
+        T* get() { return std::launder(reinterpret_cast<T*>(storage)); }
+
+        std::atomic<std::size_t> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    const std::size_t m_mask;
+    const std::unique_ptr<Slot[]> m_slots;
+    alignas(cacheLineSize) std::atomic<std::size_t> m_tail{0};
+    alignas(cacheLineSize) std::atomic<std::size_t> m_head{0};
+};
+
+}  // namespace Utils::Concurrency
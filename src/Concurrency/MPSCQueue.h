@@ -0,0 +1,16 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include "MPMCQueue.h"
+
+namespace Utils::Concurrency {
+
+// Bounded multi-producer single-consumer ring: producers claim slots like in MPMCQueue, the only consumer advances
+// the head without a CAS. Calling tryPop() from more than one thread at a time is undefined.
+template <typename T>
+using MPSCQueue = MPMCQueue<T, true>;
+
+}  // namespace Utils::Concurrency
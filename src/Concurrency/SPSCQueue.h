@@ -0,0 +1,114 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "CacheLine.h"
+
+namespace Utils::Concurrency {
+
+// Bounded single-producer single-consumer ring. Each side owns one index on its own cache line and keeps a cached
+// copy of the other side's index, so the shared line is only touched when the ring looks full or empty.
+// Capacity is rounded up to a power of two.
+template <typename T>
+class SPSCQueue {
+   public:
+    using value_type = T;
+
+    explicit SPSCQueue(std::size_t capacity)
+        : m_mask(roundUpToPowerOfTwo(capacity) - 1), m_slots(std::make_unique<Slot[]>(m_mask + 1)) {}
+
+    ~SPSCQueue() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            const auto tail = m_producer.tail.load(std::memory_order_acquire);
+            for (auto head = m_consumer.head.load(std::memory_order_relaxed); head != tail; ++head) {
+                m_slots[head & m_mask].get()->~T();
+            }
+        }
+    }
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    template <typename... Args>
+    bool tryEmplace(Args&&... args) {
+        const auto tail = m_producer.tail.load(std::memory_order_relaxed);
+        if (tail - m_producer.cachedHead > m_mask) {
+            m_producer.cachedHead = m_consumer.head.load(std::memory_order_acquire);
+            if (tail - m_producer.cachedHead > m_mask) return false;
+        }
+
+        new (m_slots[tail & m_mask].get()) T(std::forward<Args>(args)...);
+        m_producer.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(const T& value) { return tryEmplace(value); }
+    bool tryPush(T&& value) { return tryEmplace(std::move(value)); }
+
+    bool tryPop(T& out) {
+        const auto head = m_consumer.head.load(std::memory_order_relaxed);
+        if (head == m_consumer.cachedTail) {
+            m_consumer.cachedTail = m_producer.tail.load(std::memory_order_acquire);
+            if (head == m_consumer.cachedTail) return false;
+        }
+
+        T* value = m_slots[head & m_mask].get();
+        out = std::move(*value);
+        value->~T();
+        m_consumer.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side only: the oldest element, or nullptr when empty. Valid until the next tryPop()
+    T* front() {
+        const auto head = m_consumer.head.load(std::memory_order_relaxed);
+        if (head == m_consumer.cachedTail) {
+            m_consumer.cachedTail = m_producer.tail.load(std::memory_order_acquire);
+            if (head == m_consumer.cachedTail) return nullptr;
+        }
+        return m_slots[head & m_mask].get();
+    }
+
+    // Approximate when called concurrently with push/pop
+    std::size_t size() const {
+        const auto head = m_consumer.head.load(std::memory_order_acquire);
+        const auto tail = m_producer.tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    bool empty() const { return size() == 0; }
+    std::size_t capacity() const { return m_mask + 1; }
+
+   private:
+    struct Slot {
+        T* get() { return std::launder(reinterpret_cast<T*>(storage)); }
+
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    struct alignas(cacheLineSize) Producer {
+        std::atomic<std::size_t> tail{0};
+        std::size_t cachedHead = 0;
+    };
+
+    struct alignas(cacheLineSize) Consumer {
+        std::atomic<std::size_t> head{0};
+        std::size_t cachedTail = 0;
+    };
+
+    const std::size_t m_mask;
+    const std::unique_ptr<Slot[]> m_slots;
+    Producer m_producer;
+    Consumer m_consumer;
+};
+
+}  // namespace Utils::Concurrency
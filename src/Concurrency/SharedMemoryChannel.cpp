@@ -0,0 +1,536 @@
+#include "SharedMemoryChannel.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "CacheLine.h"
+
+namespace Utils::Concurrency {
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free && std::atomic<std::uint64_t>::is_always_lock_free,
+              "Shared memory atomics have to be address-free");
+
+namespace {
+
+constexpr std::uint64_t s_magic = 0x4c4e484353544c55;  // "ULTSCHNL"
+constexpr std::uint32_t s_version = 2;
+// How long a writer waits on a full ring before checking for readers of dead processes, and how old a segment that
+// never got initialized has to be before create() takes it for the leftover of a crash
+constexpr auto s_evictAfter = std::chrono::milliseconds(500);
+constexpr auto s_maxSleep = std::chrono::milliseconds(10);
+
+std::atomic<std::uint32_t> s_nextChannel{0};
+
+std::string segmentName(const std::string& name) { return name.starts_with('/') ? name : "/" + name; }
+
+constexpr std::size_t alignUp(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// The segment is shared between processes, so no FUTEX_PRIVATE_FLAG
+void waitOn(std::atomic<std::uint32_t>& word, std::uint32_t expected, std::chrono::nanoseconds timeout) {
+#if defined(__linux__)
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    timespec relative{static_cast<time_t>(seconds.count()), static_cast<long>((timeout - seconds).count())};
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT, expected, &relative, nullptr, 0);
+#else
+    if (word.load() == expected) {
+        std::this_thread::sleep_for(std::min<std::chrono::nanoseconds>(timeout, std::chrono::microseconds(50)));
+    }
+#endif
+}
+
+void wakeAll(std::atomic<std::uint32_t>& word) {
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+bool isDead(std::int32_t pid) { return pid > 0 && pid != getpid() && kill(pid, 0) != 0 && errno == ESRCH; }
+
+// A slot claim: the claiming process in the upper half, the low half of sequence + 1 in the lower one. Claims of
+// one slot are a lap apart, so the low half tells them apart.
+std::uint64_t makeClaim(std::int32_t pid, std::uint64_t sequence) {
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(pid)) << 32 | static_cast<std::uint32_t>(sequence + 1);
+}
+
+bool claims(std::uint64_t claim, std::uint64_t sequence) {
+    return static_cast<std::uint32_t>(claim) == static_cast<std::uint32_t>(sequence + 1);
+}
+
+std::int32_t claimingPid(std::uint64_t claim) { return static_cast<std::int32_t>(claim >> 32); }
+
+}  // namespace
+
+struct alignas(cacheLineSize) SharedMemoryChannel::Header {
+    std::atomic<std::uint64_t> magic{0};
+    std::uint32_t version = s_version;
+    std::uint32_t slotCount = 0;
+    std::uint32_t slotSize = 0;
+    std::uint32_t maxReaders = 0;
+    std::uint64_t slotStride = 0;
+    // Process that created the segment, create() only replaces segments of dead creators
+    std::atomic<std::int32_t> ownerPid{0};
+
+    alignas(cacheLineSize) std::atomic<std::uint64_t> writeSequence{0};
+
+    // Bumped after a commit (data) or a release (space) whenever somebody sleeps on them
+    alignas(cacheLineSize) std::atomic<std::uint32_t> dataEpoch{0};
+    std::atomic<std::uint32_t> dataWaiters{0};
+    alignas(cacheLineSize) std::atomic<std::uint32_t> spaceEpoch{0};
+    std::atomic<std::uint32_t> spaceWaiters{0};
+};
+
+struct alignas(cacheLineSize) SharedMemoryChannel::ReaderState {
+    // Sequence of the next message to read, or of the one being held
+    std::atomic<std::uint64_t> cursor{0};
+    // Process reading from this place, 0 while it is free. Claimed and evicted in one step, so eviction cannot hit a
+    // place that was just taken over by a live reader.
+    std::atomic<std::int32_t> pid{0};
+};
+
+// Followed by the payload, on its own cache line
+struct alignas(cacheLineSize) SharedMemoryChannel::SlotHeader {
+    // sequence + 1 once the message with that sequence is committed or skipped
+    std::atomic<std::uint64_t> sequence{0};
+    // makeClaim() of the writer filling the slot, set atomically with taking the slot
+    std::atomic<std::uint64_t> claim{0};
+    std::uint64_t origin = 0;
+    std::uint32_t size = 0;
+    // Set instead of a payload when the writer died, readers step over the message
+    bool skipped = false;
+};
+
+namespace {
+
+struct Layout {
+    std::size_t readersOffset;
+    std::size_t slotsOffset;
+    std::size_t slotStride;
+    std::size_t size;
+};
+
+template <typename Header, typename ReaderState, typename SlotHeader>
+Layout layoutFor(std::uint32_t slotCount, std::uint32_t slotSize, std::uint32_t maxReaders) {
+    Layout layout{};
+    layout.readersOffset = sizeof(Header);
+    layout.slotsOffset = layout.readersOffset + maxReaders * sizeof(ReaderState);
+    layout.slotStride = sizeof(SlotHeader) + alignUp(slotSize, cacheLineSize);
+    layout.size = layout.slotsOffset + slotCount * layout.slotStride;
+    return layout;
+}
+
+}  // namespace
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::create(const std::string& name,
+                                                                 SharedMemoryChannelOptions options) {
+    const auto shmName = segmentName(name);
+    bool exists = false;
+    if (auto channel = createSegment(shmName, options, exists); channel || !exists) return channel;
+
+    // Left behind by a crashed creator, or still in use by another one
+    if (isInUse(shmName)) {
+        std::cerr << "Error creating shared memory channel " << shmName << ": in use by a live process" << std::endl;
+        return nullptr;
+    }
+    shm_unlink(shmName.c_str());
+    if (auto channel = createSegment(shmName, options, exists); channel || !exists) return channel;
+
+    std::cerr << "Error creating shared memory channel " << shmName << ": created by another process meanwhile"
+              << std::endl;
+    return nullptr;
+}
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::createSegment(const std::string& shmName,
+                                                                        SharedMemoryChannelOptions options,
+                                                                        bool& exists) {
+    const auto slotCount = static_cast<std::uint32_t>(roundUpToPowerOfTwo(options.slotCount));
+    const auto layout = layoutFor<Header, ReaderState, SlotHeader>(slotCount, options.slotSize, options.maxReaders);
+
+    const int fd = shm_open(shmName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        // Left to create(), which decides whether the existing segment may be replaced
+        exists = errno == EEXIST;
+        if (!exists) {
+            std::cerr << "Error creating shared memory channel " << shmName << ": " << std::strerror(errno)
+                      << std::endl;
+        }
+        return nullptr;
+    }
+    struct stat info {};
+    if (ftruncate(fd, static_cast<off_t>(layout.size)) != 0 || fstat(fd, &info) != 0) {
+        std::cerr << "Error sizing shared memory channel " << shmName << ": " << std::strerror(errno) << std::endl;
+        close(fd);
+        shm_unlink(shmName.c_str());
+        return nullptr;
+    }
+
+    void* memory = mmap(nullptr, layout.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED) {
+        std::cerr << "Error mapping shared memory channel " << shmName << ": " << std::strerror(errno) << std::endl;
+        close(fd);
+        shm_unlink(shmName.c_str());
+        return nullptr;
+    }
+
+    auto* bytes = static_cast<std::byte*>(memory);
+    auto* header = new (memory) Header();
+    header->slotCount = slotCount;
+    header->slotSize = options.slotSize;
+    header->maxReaders = options.maxReaders;
+    header->slotStride = layout.slotStride;
+    header->ownerPid.store(static_cast<std::int32_t>(getpid()));
+    for (std::uint32_t i = 0; i < options.maxReaders; ++i) {
+        new (bytes + layout.readersOffset + i * sizeof(ReaderState)) ReaderState();
+    }
+    for (std::uint32_t i = 0; i < slotCount; ++i) {
+        new (bytes + layout.slotsOffset + i * layout.slotStride) SlotHeader();
+    }
+    // Published last, open() waits for it
+    header->magic.store(s_magic, std::memory_order_release);
+
+    std::unique_ptr<SharedMemoryChannel> channel(new SharedMemoryChannel(shmName, fd, memory, layout.size, true));
+    channel->m_device = static_cast<std::uint64_t>(info.st_dev);
+    channel->m_inode = static_cast<std::uint64_t>(info.st_ino);
+    return channel;
+}
+
+bool SharedMemoryChannel::isInUse(const std::string& shmName) {
+    const int fd = shm_open(shmName.c_str(), O_RDONLY, 0);
+    // Gone meanwhile, nobody is using it anymore
+    if (fd < 0) return false;
+
+    bool inUse = true;
+    struct stat info {};
+    if (fstat(fd, &info) == 0) {
+        // ctime only counts whole seconds here
+        const auto changed = std::chrono::system_clock::from_time_t(info.st_ctim.tv_sec);
+        const bool recent = std::chrono::system_clock::now() - changed < s_evictAfter + std::chrono::seconds(1);
+        void* memory = static_cast<std::size_t>(info.st_size) >= sizeof(Header)
+                           ? mmap(nullptr, sizeof(Header), PROT_READ, MAP_SHARED, fd, 0)
+                           : MAP_FAILED;
+        if (memory != MAP_FAILED) {
+            const auto* header = static_cast<const Header*>(memory);
+            if (header->magic.load(std::memory_order_acquire) == s_magic) {
+                inUse = !isDead(header->ownerPid.load());
+            } else {
+                // Its creator may still be initializing it
+                inUse = recent;
+            }
+            munmap(memory, sizeof(Header));
+        } else {
+            inUse = recent;
+        }
+    }
+    close(fd);
+    return inUse;
+}
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::open(const std::string& name,
+                                                               std::chrono::milliseconds timeout) {
+    const auto shmName = segmentName(name);
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    // The creator may still be between shm_open() and publishing the header
+    int fd = -1;
+    struct stat info {};
+    for (;;) {
+        if (fd < 0) fd = shm_open(shmName.c_str(), O_RDWR, 0600);
+        if (fd >= 0 && fstat(fd, &info) == 0 && static_cast<std::size_t>(info.st_size) >= sizeof(Header)) break;
+        if (std::chrono::steady_clock::now() >= deadline) {
+            std::cerr << "Error opening shared memory channel " << shmName << ": "
+                      << (fd < 0 ? std::strerror(errno) : "segment was never initialized") << std::endl;
+            if (fd >= 0) close(fd);
+            return nullptr;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    const auto size = static_cast<std::size_t>(info.st_size);
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED) {
+        std::cerr << "Error mapping shared memory channel " << shmName << ": " << std::strerror(errno) << std::endl;
+        close(fd);
+        return nullptr;
+    }
+
+    auto* header = static_cast<Header*>(memory);
+    while (header->magic.load(std::memory_order_acquire) != s_magic) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            std::cerr << "Error opening shared memory channel " << shmName << ": not a channel" << std::endl;
+            munmap(memory, size);
+            close(fd);
+            return nullptr;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    const auto layout = layoutFor<Header, ReaderState, SlotHeader>(header->slotCount, header->slotSize,
+                                                                   header->maxReaders);
+    if (header->version != s_version || layout.size != size || layout.slotStride != header->slotStride) {
+        std::cerr << "Error opening shared memory channel " << shmName << ": incompatible layout" << std::endl;
+        munmap(memory, size);
+        close(fd);
+        return nullptr;
+    }
+
+    return std::unique_ptr<SharedMemoryChannel>(new SharedMemoryChannel(shmName, fd, memory, size, false));
+}
+
+SharedMemoryChannel::SharedMemoryChannel(std::string name, int fd, void* memory, std::size_t size, bool owner)
+    : m_name(std::move(name)),
+      m_fd(fd),
+      m_memory(memory),
+      m_size(size),
+      m_owner(owner),
+      m_originId(static_cast<std::uint64_t>(getpid()) << 32 | s_nextChannel.fetch_add(1, std::memory_order_relaxed)),
+      m_header(static_cast<Header*>(memory)) {}
+
+SharedMemoryChannel::~SharedMemoryChannel() {
+    munmap(m_memory, m_size);
+    close(m_fd);
+    if (!m_owner) return;
+
+    // Only the segment this channel created: once unlinked by someone else, the name may belong to a new one
+    const int fd = shm_open(m_name.c_str(), O_RDONLY, 0);
+    if (fd < 0) return;
+    struct stat info {};
+    const bool same = fstat(fd, &info) == 0 && static_cast<std::uint64_t>(info.st_dev) == m_device &&
+                      static_cast<std::uint64_t>(info.st_ino) == m_inode;
+    close(fd);
+    if (same) shm_unlink(m_name.c_str());
+}
+
+bool SharedMemoryChannel::write(std::span<const std::byte> data) { return write(data, true); }
+
+bool SharedMemoryChannel::tryWrite(std::span<const std::byte> data) { return write(data, false); }
+
+bool SharedMemoryChannel::write(std::span<const std::byte> data, bool block) {
+    if (data.size() > m_header->slotSize) {
+        std::cerr << "Error writing to shared memory channel " << m_name << ": " << data.size()
+                  << " bytes exceed the slot size of " << m_header->slotSize << std::endl;
+        return false;
+    }
+
+    const auto pid = static_cast<std::int32_t>(getpid());
+    const auto blockedSince = std::chrono::steady_clock::now();
+    std::uint64_t sequence = 0;
+    for (;;) {
+        sequence = m_header->writeSequence.load();
+        if (!hasSpace(sequence)) {
+            if (!block) return false;
+
+            // Back-pressure: the slowest reader still holds the slot we would overwrite
+            const auto epoch = m_header->spaceEpoch.load();
+            m_header->spaceWaiters.fetch_add(1);
+            if (!hasSpace(sequence)) waitOn(m_header->spaceEpoch, epoch, s_maxSleep);
+            m_header->spaceWaiters.fetch_sub(1);
+
+            if (std::chrono::steady_clock::now() - blockedSince > s_evictAfter) evictDeadReaders();
+            continue;
+        }
+
+        auto& target = slot(sequence);
+        auto claim = target.claim.load();
+        if (claims(claim, sequence)) {
+            // Taken by a writer that has not moved the sequence on yet, or never will because it died
+            m_header->writeSequence.compare_exchange_strong(sequence, sequence + 1);
+            continue;
+        }
+
+        // The readers are done with the slot's previous lap, but its writer may still be filling it: with no reader
+        // attached nothing else stops two writers a full ring apart
+        const auto previousLap = sequence >= m_header->slotCount ? sequence - m_header->slotCount + 1 : 0;
+        if (target.sequence.load() != previousLap) {
+            if (!block) return false;
+
+            const auto epoch = m_header->dataEpoch.load();
+            m_header->dataWaiters.fetch_add(1);
+            if (target.sequence.load() != previousLap) waitOn(m_header->dataEpoch, epoch, s_maxSleep);
+            m_header->dataWaiters.fetch_sub(1);
+            recoverSlot(previousLap - 1);
+            continue;
+        }
+
+        // Claimed with our pid in one step, so a slot of a writer dying from here on can always be recovered
+        if (!target.claim.compare_exchange_strong(claim, makeClaim(pid, sequence))) continue;
+        m_header->writeSequence.compare_exchange_strong(sequence, sequence + 1);
+        break;
+    }
+
+    auto& target = slot(sequence);
+    std::memcpy(payload(target), data.data(), data.size());
+    target.size = static_cast<std::uint32_t>(data.size());
+    target.origin = m_originId;
+    target.skipped = false;
+    target.sequence.store(sequence + 1);
+    notifyData();
+    return true;
+}
+
+std::unique_ptr<SharedMemoryChannel::Reader> SharedMemoryChannel::subscribe() {
+    const auto pid = static_cast<std::int32_t>(getpid());
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        for (std::uint32_t i = 0; i < m_header->maxReaders; ++i) {
+            auto& state = readerState(i);
+            std::int32_t free = 0;
+            if (!state.pid.compare_exchange_strong(free, pid)) continue;
+
+            // Until the cursor is set writers see the previous owner's, which is only more conservative
+            const auto cursor = m_header->writeSequence.load();
+            state.cursor.store(cursor);
+            return std::unique_ptr<Reader>(new Reader(*this, i, cursor));
+        }
+        // Places of crashed readers are only reclaimed by blocked writers otherwise, which an idle channel never has
+        evictDeadReaders();
+    }
+
+    std::cerr << "Error subscribing to shared memory channel " << m_name << ": all " << m_header->maxReaders
+              << " reader places are taken" << std::endl;
+    return nullptr;
+}
+
+const std::string& SharedMemoryChannel::getName() const { return m_name; }
+std::uint64_t SharedMemoryChannel::getOriginId() const { return m_originId; }
+std::size_t SharedMemoryChannel::getSlotSize() const { return m_header->slotSize; }
+std::size_t SharedMemoryChannel::getSlotCount() const { return m_header->slotCount; }
+
+SharedMemoryChannel::ReaderState& SharedMemoryChannel::readerState(std::uint32_t index) const {
+    auto* bytes = static_cast<std::byte*>(m_memory) + sizeof(Header) + index * sizeof(ReaderState);
+    return *std::launder(reinterpret_cast<ReaderState*>(bytes));
+}
+
+SharedMemoryChannel::SlotHeader& SharedMemoryChannel::slot(std::uint64_t sequence) const {
+    const auto index = sequence & (m_header->slotCount - 1);
+    auto* bytes = static_cast<std::byte*>(m_memory) + sizeof(Header) + m_header->maxReaders * sizeof(ReaderState) +
+                  index * m_header->slotStride;
+    return *std::launder(reinterpret_cast<SlotHeader*>(bytes));
+}
+
+std::byte* SharedMemoryChannel::payload(SlotHeader& slot) const {
+    return reinterpret_cast<std::byte*>(&slot) + sizeof(SlotHeader);
+}
+
+bool SharedMemoryChannel::hasSpace(std::uint64_t sequence) const {
+    for (std::uint32_t i = 0; i < m_header->maxReaders; ++i) {
+        const auto& state = readerState(i);
+        if (state.pid.load() != 0 && sequence - state.cursor.load() >= m_header->slotCount) return false;
+    }
+    return true;
+}
+
+void SharedMemoryChannel::evictDeadReaders() {
+    for (std::uint32_t i = 0; i < m_header->maxReaders; ++i) {
+        auto& state = readerState(i);
+        auto pid = state.pid.load();
+        if (!isDead(pid)) continue;
+        if (state.pid.compare_exchange_strong(pid, 0)) {
+            std::cerr << "Detaching reader of dead process " << pid << " from shared memory channel " << m_name
+                      << std::endl;
+            notifySpace();
+        }
+    }
+}
+
+void SharedMemoryChannel::recoverSlot(std::uint64_t sequence) {
+    auto& target = slot(sequence);
+    auto claim = target.claim.load();
+    if (!claims(claim, sequence) || target.sequence.load() == sequence + 1) return;
+
+    const auto pid = claimingPid(claim);
+    if (!isDead(pid)) return;
+    // Taken over first, so only one process fills in the skipped message
+    if (!target.claim.compare_exchange_strong(claim, makeClaim(static_cast<std::int32_t>(getpid()), sequence))) return;
+
+    std::cerr << "Skipping message " << sequence << " of dead writer process " << pid << " in shared memory channel "
+              << m_name << std::endl;
+    target.size = 0;
+    target.origin = 0;
+    target.skipped = true;
+    target.sequence.store(sequence + 1);
+    // The writer may have died before moving the sequence on
+    m_header->writeSequence.compare_exchange_strong(sequence, sequence + 1);
+    notifyData();
+}
+
+void SharedMemoryChannel::notifyData() {
+    if (m_header->dataWaiters.load() != 0) {
+        m_header->dataEpoch.fetch_add(1);
+        wakeAll(m_header->dataEpoch);
+    }
+}
+
+void SharedMemoryChannel::notifySpace() {
+    if (m_header->spaceWaiters.load() != 0) {
+        m_header->spaceEpoch.fetch_add(1);
+        wakeAll(m_header->spaceEpoch);
+    }
+}
+
+SharedMemoryChannel::Reader::Reader(SharedMemoryChannel& channel, std::uint32_t index, std::uint64_t cursor)
+    : m_channel(channel), m_index(index), m_cursor(cursor) {}
+
+SharedMemoryChannel::Reader::~Reader() {
+    release();
+    m_channel.readerState(m_index).pid.store(0);
+    m_channel.notifySpace();
+}
+
+std::optional<SharedMemoryChannel::Message> SharedMemoryChannel::Reader::read(std::chrono::milliseconds timeout) {
+    release();
+
+    auto& header = *m_channel.m_header;
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    for (;;) {
+        auto& slot = m_channel.slot(m_cursor);
+        if (slot.sequence.load() == m_cursor + 1) {
+            m_holding = true;
+            if (!slot.skipped) return Message{{m_channel.payload(slot), slot.size}, slot.origin};
+
+            release();
+            continue;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) return std::nullopt;
+
+        const auto epoch = header.dataEpoch.load();
+        header.dataWaiters.fetch_add(1);
+        if (slot.sequence.load() != m_cursor + 1) {
+            waitOn(header.dataEpoch, epoch, std::min<std::chrono::nanoseconds>(deadline - now, s_maxSleep));
+        }
+        header.dataWaiters.fetch_sub(1);
+        // Committed messages wake us up, a writer that died holding the slot never will
+        m_channel.recoverSlot(m_cursor);
+    }
+}
+
+void SharedMemoryChannel::Reader::release() {
+    if (!m_holding) return;
+    m_holding = false;
+
+    m_channel.readerState(m_index).cursor.store(++m_cursor);
+    m_channel.notifySpace();
+}
+
+}  // namespace Utils::Concurrency
@@ -0,0 +1,129 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace Utils::Concurrency {
+
+struct SharedMemoryChannelOptions {
+    // Rounded up to a power of two
+    std::uint32_t slotCount = 1024;
+    // Largest payload a single message can carry
+    std::uint32_t slotSize = 256;
+    std::uint32_t maxReaders = 16;
+};
+
+// Broadcast ring in a POSIX shared memory segment, for processes on the same host. Writers from any process claim
+// fixed-size slots, every attached reader sees every message written after it attached, and a writer blocks while
+// the slowest reader is a full ring behind. Idle readers and writers sleep on a futex on Linux and poll elsewhere.
+// Readers whose process died are detached once a writer has been blocked on them for a while, or when subscribe()
+// finds no free place. A slot claimed by a process that died before committing it is skipped by everybody waiting
+// on it, so a crashed writer does not stall the channel.
+class SharedMemoryChannel {
+   public:
+    struct Message {
+        // Points straight into the segment, aligned to a cache line
+        std::span<const std::byte> payload;
+        // getOriginId() of the channel that wrote the message
+        std::uint64_t origin = 0;
+    };
+
+    class Reader {
+       public:
+        ~Reader();
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        // Waits up to timeout for the next message. Its payload stays valid, and its slot reserved, until the next
+        // call to read() or release(). Messages of writers that died before committing them are skipped.
+        std::optional<Message> read(std::chrono::milliseconds timeout);
+
+        // Gives the slot of the last read message back to the writers
+        void release();
+
+       private:
+        friend class SharedMemoryChannel;
+
+        Reader(SharedMemoryChannel& channel, std::uint32_t index, std::uint64_t cursor);
+
+        SharedMemoryChannel& m_channel;
+        const std::uint32_t m_index;
+        std::uint64_t m_cursor;
+        bool m_holding = false;
+    };
+
+    // Creates a fresh segment and unlinks it again on destruction, unless it was replaced meanwhile. A segment of the
+    // same name is only replaced when its creator died; returns nullptr if it is still in use or on failure.
+    static std::unique_ptr<SharedMemoryChannel> create(const std::string& name,
+                                                       SharedMemoryChannelOptions options = {});
+
+    // Attaches to a segment made by create(), waiting up to timeout for it to appear. Returns nullptr on failure.
+    static std::unique_ptr<SharedMemoryChannel> open(const std::string& name,
+                                                     std::chrono::milliseconds timeout = std::chrono::seconds(1));
+
+    ~SharedMemoryChannel();
+
+    SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+    SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+
+    // Copies the payload into the next slot, blocking while the ring is full. False when it does not fit a slot.
+    bool write(std::span<const std::byte> payload);
+    // Like write(), but also false instead of blocking when the ring is full
+    bool tryWrite(std::span<const std::byte> payload);
+
+    // Starts reading at the next written message, nullptr when all reader places are taken by live processes
+    std::unique_ptr<Reader> subscribe();
+
+    const std::string& getName() const;
+    std::uint64_t getOriginId() const;
+    std::size_t getSlotSize() const;
+    std::size_t getSlotCount() const;
+
+   private:
+    struct Header;
+    struct ReaderState;
+    struct SlotHeader;
+
+    SharedMemoryChannel(std::string name, int fd, void* memory, std::size_t size, bool owner);
+
+    // exists tells a name that is taken apart from other failures
+    static std::unique_ptr<SharedMemoryChannel> createSegment(const std::string& shmName,
+                                                              SharedMemoryChannelOptions options, bool& exists);
+    // True when an existing segment of that name belongs to a live process, or is still being created
+    static bool isInUse(const std::string& shmName);
+
+    bool write(std::span<const std::byte> payload, bool block);
+    ReaderState& readerState(std::uint32_t index) const;
+    SlotHeader& slot(std::uint64_t sequence) const;
+    std::byte* payload(SlotHeader& slot) const;
+    bool hasSpace(std::uint64_t sequence) const;
+    void evictDeadReaders();
+    // Skips the message if the process that claimed its slot died before committing it
+    void recoverSlot(std::uint64_t sequence);
+    void notifyData();
+    void notifySpace();
+
+   private:
+    const std::string m_name;
+    const int m_fd;
+    void* const m_memory;
+    const std::size_t m_size;
+    const bool m_owner;
+    // Identify the segment this channel created, see ~SharedMemoryChannel()
+    std::uint64_t m_device = 0;
+    std::uint64_t m_inode = 0;
+    const std::uint64_t m_originId;
+    Header* const m_header;
+};
+
+}  // namespace Utils::Concurrency
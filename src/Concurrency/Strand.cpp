@@ -0,0 +1,117 @@
+#include "Strand.h"
+
+#include <utility>
+
+namespace Utils::Concurrency {
+
+namespace {
+
+// Strands whose turn is running on this thread, innermost first. A worker waiting inside one turn may pick up the
+// turn of another strand, and only this thread can ever advance any of them.
+struct ActiveStrand {
+    Strand* strand;
+    ActiveStrand* outer;
+};
+
+thread_local ActiveStrand* t_activeStrands = nullptr;
+
+// Enters a strand's turn on this thread for the lifetime of the scope
+class ActiveStrandScope {
+   public:
+    explicit ActiveStrandScope(Strand* strand) : m_entry{strand, t_activeStrands} { t_activeStrands = &m_entry; }
+    ~ActiveStrandScope() { t_activeStrands = m_entry.outer; }
+
+    ActiveStrandScope(const ActiveStrandScope&) = delete;
+    ActiveStrandScope& operator=(const ActiveStrandScope&) = delete;
+
+   private:
+    ActiveStrand m_entry;
+};
+
+bool isCurrent(const Strand* strand) { return t_activeStrands != nullptr && t_activeStrands->strand == strand; }
+
+// Tasks run per turn before the strand gives its worker back to the other queued work
+constexpr int s_tasksPerTurn = 64;
+
+}  // namespace
+
+Strand::Strand(WorkStealingExecutor& executor) : m_executor(executor) {}
+
+void Strand::post(Task task) {
+    // Inline, so an exception reaches the task that posted it
+    if (isCurrent(this)) {
+        task();
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+        if (m_scheduled) {
+            // The strand's current task may be waiting on the executor for exactly this one
+            m_executor.signal();
+            return;
+        }
+        m_scheduled = true;
+    }
+    m_executor.submit([self = shared_from_this()] { self->drain(); });
+}
+
+void Strand::post(TaskGroup& group, Task task) {
+    if (isCurrent(this)) {
+        WorkStealingExecutor::runInGroup(group, task);
+        return;
+    }
+
+    m_executor.begin(group);
+    post([this, &group, task = std::move(task)]() mutable {
+        WorkStealingExecutor::runInGroup(group, task);
+        m_executor.finish(group);
+    });
+}
+
+void Strand::drain() {
+    // Once the last group finishes the owner may drop the strand, this turn keeps it alive until it returns
+    const auto self = shared_from_this();
+    {
+        ActiveStrandScope active(this);
+        for (int i = 0; i < s_tasksPerTurn; ++i) {
+            Task task;
+            {
+                std::lock_guard lock(m_mutex);
+                if (m_tasks.empty()) {
+                    m_scheduled = false;
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            // A throwing task must not end the turn while the strand stays scheduled
+            WorkStealingExecutor::runDetached(task);
+        }
+    }
+
+    // Still scheduled, continue in a fresh turn
+    m_executor.submit([self] { self->drain(); });
+}
+
+bool Strand::runQueuedTaskOfActive() {
+    for (auto* active = t_activeStrands; active != nullptr; active = active->outer) {
+        auto* const strand = active->strand;
+        Task task;
+        {
+            std::lock_guard lock(strand->m_mutex);
+            if (strand->m_tasks.empty()) continue;
+            task = std::move(strand->m_tasks.front());
+            strand->m_tasks.pop_front();
+        }
+
+        // Still within the strand's turn: the task runs nested in the waiting one, never next to another of its tasks
+        ActiveStrandScope nested(strand);
+        WorkStealingExecutor::runDetached(task);
+        return true;
+    }
+    return false;
+}
+
+}  // namespace Utils::Concurrency
@@ -0,0 +1,47 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "WorkStealingExecutor.h"
+
+namespace Utils::Concurrency {
+
+// Runs the tasks posted to it on an executor one at a time and in posting order. A task posted from inside a task of
+// the same strand runs inline, so a callback re-entering its own strand cannot wait on itself, and a task of the
+// strand waiting on the executor runs the queued tasks of the strands it is inside meanwhile, so strands waiting on
+// each other cannot deadlock. Such nested tasks run inside the waiting one, so a strand's tasks never run on two threads
+// at once but can re-enter each other. Exceptions of grouped tasks go to the group's waiter, the others are logged.
+// Created with std::make_shared: queued turns keep the strand alive, it may be released while busy.
+class Strand : public std::enable_shared_from_this<Strand> {
+   public:
+    using Task = WorkStealingExecutor::Task;
+
+    explicit Strand(WorkStealingExecutor& executor);
+
+    Strand(const Strand&) = delete;
+    Strand& operator=(const Strand&) = delete;
+
+    void post(Task task);
+    void post(TaskGroup& group, Task task);
+
+   private:
+    friend class WorkStealingExecutor;
+
+    void drain();
+    // Runs the next queued task of a strand whose turn is running on the calling thread, false if there is none
+    static bool runQueuedTaskOfActive();
+
+   private:
+    WorkStealingExecutor& m_executor;
+    std::mutex m_mutex;
+    std::deque<Task> m_tasks;
+    bool m_scheduled = false;
+};
+
+}  // namespace Utils::Concurrency
@@ -0,0 +1,98 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include "CacheLine.h"
+
+namespace Utils::Concurrency {
+
+// Bounded Chase-Lev deque (Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models"). The owning
+// thread pushes and pops at the bottom in LIFO order, any other thread steals from the top in FIFO order.
+// Holds small trivially copyable values, typically pointers to tasks.
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T> && std::atomic<T>::is_always_lock_free);
+
+   public:
+    explicit WorkStealingDeque(std::size_t capacity)
+        : m_mask(roundUpToPowerOfTwo(capacity) - 1), m_buffer(std::make_unique<std::atomic<T>[]>(m_mask + 1)) {}
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only
+    bool push(T value) {
+        const auto bottom = m_bottom.load(std::memory_order_relaxed);
+        const auto top = m_top.load(std::memory_order_acquire);
+        if (bottom - top > static_cast<std::int64_t>(m_mask)) return false;
+
+        m_buffer[bottom & m_mask].store(value, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Owner only
+    std::optional<T> pop() {
+        const auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        std::optional<T> value = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last element, race the thieves for it
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                value.reset();
+            }
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return value;
+    }
+
+    // Any thread; also empty when it lost a race with another thief or the owner
+    std::optional<T> steal() {
+        auto top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom) return std::nullopt;
+
+        const T value = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    // Approximate when called concurrently
+    std::size_t size() const {
+        const auto bottom = m_bottom.load(std::memory_order_acquire);
+        const auto top = m_top.load(std::memory_order_acquire);
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+    std::size_t capacity() const { return m_mask + 1; }
+
+   private:
+    const std::size_t m_mask;
+    const std::unique_ptr<std::atomic<T>[]> m_buffer;
+    alignas(cacheLineSize) std::atomic<std::int64_t> m_top{0};
+    alignas(cacheLineSize) std::atomic<std::int64_t> m_bottom{0};
+};
+
+}  // namespace Utils::Concurrency
@@ -0,0 +1,215 @@
+#include "WorkStealingExecutor.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+#include "Strand.h"
+
+namespace Utils::Concurrency {
+
+namespace {
+
+struct CurrentWorker {
+    const void* executor = nullptr;
+    void* worker = nullptr;
+};
+
+thread_local CurrentWorker t_currentWorker;
+
+// xorshift32, only used to spread thieves over victims
+std::uint32_t nextRandom() {
+    thread_local std::uint32_t state =
+        static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+void pinCurrentThread(std::size_t index, const std::vector<int>& cpus) {
+    if (cpus.empty()) return;
+
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const int cpu : cpus) {
+        // CPU_SET does not check its argument, out of range indices would write past the set
+        if (cpu < 0 || cpu >= CPU_SETSIZE) {
+            std::cerr << "Error pinning executor worker " << index << ": invalid CPU index " << cpu << std::endl;
+            return;
+        }
+        CPU_SET(cpu, &set);
+    }
+    if (const int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set); rc != 0) {
+        std::cerr << "Error pinning executor worker " << index << ": " << std::strerror(rc) << std::endl;
+    }
+#else
+    std::cerr << "Error pinning executor worker " << index << ": CPU affinity is not supported" << std::endl;
+#endif
+}
+
+std::size_t resolveThreadCount(std::size_t threadCount) {
+    return threadCount != 0 ? threadCount : std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+}  // namespace
+
+WorkStealingExecutor::WorkStealingExecutor(ExecutorOptions options)
+    : m_injected(options.queueCapacity * resolveThreadCount(options.threadCount)) {
+    const auto threadCount = resolveThreadCount(options.threadCount);
+
+    // All deques have to exist before the first worker starts stealing
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        m_workers.push_back(std::make_unique<Worker>(options.queueCapacity));
+    }
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        auto cpus = options.cpuSets.empty() ? std::vector<int>{} : options.cpuSets[i % options.cpuSets.size()];
+        m_workers[i]->thread = std::jthread(
+            [this, i, cpus = std::move(cpus)](std::stop_token token) { run(i, cpus, std::move(token)); });
+    }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+    for (auto& worker : m_workers) worker->thread.request_stop();
+    m_epoch.fetch_add(1);
+    m_epoch.notify_all();
+    for (auto& worker : m_workers) worker->thread.join();
+
+    // Whatever got submitted while the workers were leaving
+    while (runOne(nullptr)) {
+    }
+}
+
+void WorkStealingExecutor::submit(Task task) {
+    enqueue(new Task(std::move(task)));
+    signal();
+}
+
+void WorkStealingExecutor::submit(TaskGroup& group, Task task) {
+    begin(group);
+    submit([this, &group, task = std::move(task)]() mutable {
+        runInGroup(group, task);
+        finish(group);
+    });
+}
+
+void WorkStealingExecutor::wait(TaskGroup& group) {
+    auto* self = currentWorker();
+    while (!group.done()) {
+        // Tasks queued on the strands this thread is inside can only run here, another waiter may depend on them
+        if (Strand::runQueuedTaskOfActive() || runOne(self)) continue;
+
+        const auto epoch = m_epoch.load();
+        if (group.done()) break;
+        if (Strand::runQueuedTaskOfActive() || runOne(self)) continue;
+
+        m_sleeping.fetch_add(1);
+        m_epoch.wait(epoch);
+        m_sleeping.fetch_sub(1);
+    }
+
+    // Cleared so a reused group does not report it again
+    if (group.m_failed.exchange(false, std::memory_order_acquire)) {
+        std::rethrow_exception(std::exchange(group.m_exception, nullptr));
+    }
+}
+
+std::size_t WorkStealingExecutor::getThreadCount() const { return m_workers.size(); }
+
+void WorkStealingExecutor::begin(TaskGroup& group) { group.m_pending.fetch_add(1, std::memory_order_relaxed); }
+
+// The executor outlives the group, so waiters sleep on m_epoch and never on the group itself
+void WorkStealingExecutor::finish(TaskGroup& group) {
+    if (group.m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) signal();
+}
+
+void WorkStealingExecutor::runInGroup(TaskGroup& group, Task& task) {
+    try {
+        task();
+    } catch (...) {
+        // Published to wait() by the release of finish()
+        if (!group.m_failed.exchange(true, std::memory_order_relaxed)) group.m_exception = std::current_exception();
+    }
+}
+
+void WorkStealingExecutor::runDetached(Task& task) {
+    try {
+        task();
+    } catch (const std::exception& e) {
+        std::cerr << "Error in executor task: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "Error in executor task: unknown exception" << std::endl;
+    }
+}
+
+WorkStealingExecutor::Worker* WorkStealingExecutor::currentWorker() const {
+    return t_currentWorker.executor == this ? static_cast<Worker*>(t_currentWorker.worker) : nullptr;
+}
+
+void WorkStealingExecutor::enqueue(Task* task) {
+    if (auto* self = currentWorker(); self && self->deque.push(task)) return;
+    if (m_injected.tryPush(task)) return;
+
+    // Every queue is full: back-pressure by running the task on the submitting thread
+    std::unique_ptr<Task> owned(task);
+    runDetached(*owned);
+}
+
+bool WorkStealingExecutor::runOne(Worker* self) {
+    Task* task = nullptr;
+    if (self) {
+        if (const auto own = self->deque.pop()) task = *own;
+    }
+    if (!task) m_injected.tryPop(task);
+    if (!task) {
+        const auto count = m_workers.size();
+        const auto start = nextRandom() % count;
+        for (std::size_t i = 0; i < count && !task; ++i) {
+            auto& victim = *m_workers[(start + i) % count];
+            if (&victim == self) continue;
+            if (const auto stolen = victim.deque.steal()) task = *stolen;
+        }
+    }
+    if (!task) return false;
+
+    std::unique_ptr<Task> owned(task);
+    runDetached(*owned);
+    return true;
+}
+
+// Sequentially consistent on purpose, see BlockingQueue: either the sleeper sees the new epoch or we see the sleeper
+void WorkStealingExecutor::signal() {
+    m_epoch.fetch_add(1);
+    if (m_sleeping.load() != 0) m_epoch.notify_all();
+}
+
+void WorkStealingExecutor::run(std::size_t index, const std::vector<int>& cpus, std::stop_token token) {
+    t_currentWorker = {this, m_workers[index].get()};
+    pinCurrentThread(index, cpus);
+
+    auto* self = m_workers[index].get();
+    constexpr int spinCount = 64;
+    for (;;) {
+        bool ran = false;
+        for (int spin = 0; spin < spinCount && !ran; ++spin) ran = runOne(self);
+        if (ran) continue;
+
+        // Leave only once every queue is drained
+        const auto epoch = m_epoch.load();
+        if (runOne(self)) continue;
+        if (token.stop_requested()) return;
+
+        m_sleeping.fetch_add(1);
+        m_epoch.wait(epoch);
+        m_sleeping.fetch_sub(1);
+    }
+}
+
+}  // namespace Utils::Concurrency
@@ -0,0 +1,102 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "MPMCQueue.h"
+#include "WorkStealingDeque.h"
+
+namespace Utils::Concurrency {
+
+struct ExecutorOptions {
+    // 0 uses std::thread::hardware_concurrency()
+    std::size_t threadCount = 0;
+    // Worker i is pinned to cpuSets[i % cpuSets.size()], no pinning when empty. Only supported on Linux, a set with
+    // a CPU index outside [0, CPU_SETSIZE) is rejected and leaves its workers unpinned.
+    std::vector<std::vector<int>> cpuSets = {};
+    // Capacity of every worker deque and of the queue for tasks submitted from outside the pool
+    std::size_t queueCapacity = 1024;
+};
+
+// Counts the tasks submitted with it that did not finish yet, and keeps the first exception one of them threw
+class TaskGroup {
+   public:
+    bool done() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+   private:
+    friend class WorkStealingExecutor;
+
+    std::atomic<std::uint32_t> m_pending{0};
+    std::atomic<bool> m_failed{false};
+    // Written once, by the task that set m_failed, and read by wait() after the group is done
+    std::exception_ptr m_exception;
+};
+
+// Thread pool where each worker owns a Chase-Lev deque. Tasks submitted from a worker go to its own deque, tasks
+// from other threads to a shared injection queue; idle workers steal from the others, so uneven task costs do not
+// leave cores idle. When every queue is full, the submitting thread runs the task itself.
+// An exception thrown by a task of a group is rethrown by wait() once the whole group finished; tasks submitted
+// without a group have nobody to report to, their exceptions are logged and dropped.
+class WorkStealingExecutor {
+   public:
+    using Task = std::move_only_function<void()>;
+
+    explicit WorkStealingExecutor(ExecutorOptions options = {});
+    ~WorkStealingExecutor();
+
+    WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+    WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+    void submit(Task task);
+    void submit(TaskGroup& group, Task task);
+
+    // Runs queued tasks on the calling thread until every task of the group has finished, then rethrows the first
+    // exception a task of the group threw. Called from a task of a Strand, the strand's own queued tasks are run as well.
+    void wait(TaskGroup& group);
+
+    std::size_t getThreadCount() const;
+
+   private:
+    friend class Strand;
+
+    struct Worker {
+        explicit Worker(std::size_t capacity) : deque(capacity) {}
+
+        WorkStealingDeque<Task*> deque;
+        std::jthread thread;
+    };
+
+    // Group accounting for tasks that reach the executor wrapped by someone else, see Strand
+    void begin(TaskGroup& group);
+    void finish(TaskGroup& group);
+    // Runs a task of the group, keeping what it throws for wait()
+    static void runInGroup(TaskGroup& group, Task& task);
+    // Runs a task nobody waits for, logging what it throws
+    static void runDetached(Task& task);
+
+    Worker* currentWorker() const;
+    void enqueue(Task* task);
+    bool runOne(Worker* self);
+    void signal();
+    void run(std::size_t index, const std::vector<int>& cpus, std::stop_token token);
+
+   private:
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    MPMCQueue<Task*> m_injected;
+
+    // Bumped on every submission and group completion, idle threads sleep on it
+    alignas(cacheLineSize) std::atomic<std::uint32_t> m_epoch{0};
+    std::atomic<std::uint32_t> m_sleeping{0};
+};
+
+}  // namespace Utils::Concurrency
@@ -0,0 +1,187 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Concurrency/WorkStealingExecutor.h"
+#include "ConfigParser/JsonConfigParser.h"
+#include "ConfigParser/JsonIndex.h"
+#include "ConfigParser/MappedFile.h"
+#include "IConfigProvider.h"
+
+namespace Utils::Config {
+
+namespace detail {
+
+template <typename T>
+concept StringKeyedMap = requires { typename T::mapped_type; } && std::is_convertible_v<typename T::key_type, std::string_view>;
+
+template <typename T>
+void mergeSetFields(T* target, T& source, JsonIndex& document, const std::string& pointer);
+
+// Moves one value the document set from source into target. Objects read into structs or string keyed maps merge key
+// by key, like glaze does when it reads a document into an already filled Config; anything else replaces the whole
+// value. With target == nullptr only the document paths are resolved, which builds the index ahead of the merge.
+template <typename T>
+void mergeSetField(T* target, T& source, JsonIndex& document, const std::string& pointer) {
+    const auto value = document.find(pointer);
+    if (!value) return;
+
+    if constexpr (glz::reflectable<T> || StringKeyedMap<T>) {
+        if (value->starts_with('{')) {
+            mergeSetFields(target, source, document, pointer);
+            return;
+        }
+    }
+    if (target) *target = std::move(source);
+}
+
+template <typename T>
+void mergeSetFields(T* target, T& source, JsonIndex& document, const std::string& pointer) {
+    if constexpr (glz::reflectable<T>) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (mergeSetField(target ? &glz::get<I>(glz::to_tie(*target)) : nullptr, glz::get<I>(glz::to_tie(source)),
+                           document, pointer + "/" + JsonIndex::escapeToken(glz::reflect<T>::keys[I])),
+             ...);
+        }(std::make_index_sequence<glz::reflect<T>::size>{});
+    } else if constexpr (StringKeyedMap<T>) {
+        // The parsed map holds exactly the keys this document set
+        for (auto& [key, value] : source) {
+            auto* merged = target ? &(*target)[key] : nullptr;
+            mergeSetField(merged, value, document, pointer + "/" + JsonIndex::escapeToken(std::string_view(key)));
+        }
+    }
+}
+
+}  // namespace detail
+
+// Loads a config split across many JSON files (defaults, per-module files, overrides) into one Config.
+// Every file is mapped and parsed into its own Config on the loader's worker pool, together with an index of the keys
+// it actually sets. The Configs are then merged in ascending precedence (later files win, objects merge key by key),
+// moving only the fields a file set, so the result equals reading the files one after another into the same struct.
+// The merge is the only serial step and its cost follows the number of keys, not the size of the files, see
+// BM_ConfigDirectoryLoader_Load against BM_ConfigDirectoryLoader_SequentialParse.
+template <typename Config>
+class ConfigDirectoryLoader {
+   public:
+    // 0 uses one worker per hardware thread. The pool is created once and reused by every load().
+    explicit ConfigDirectoryLoader(std::size_t threadCount = 0)
+        : ConfigDirectoryLoader(makeExecutor(threadCount > 0 ? threadCount
+                                                             : std::max(1u, std::thread::hardware_concurrency()))) {}
+
+    // Shares an existing pool, nullptr loads on the calling thread
+    explicit ConfigDirectoryLoader(std::shared_ptr<Concurrency::WorkStealingExecutor> executor)
+        : m_executor(std::move(executor)) {}
+
+    // Regular "*.json" files of the directory sorted by file name, which is their precedence:
+    // e.g. "00-defaults.json" < "10-network.json" < "99-overrides.json".
+    // Empty if the directory cannot be listed.
+    static std::vector<std::filesystem::path> listConfigFiles(const std::filesystem::path& directory) {
+        std::vector<std::filesystem::path> files;
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+            std::error_code typeEc;
+            if (it->is_regular_file(typeEc) && it->path().extension() == ".json") {
+                files.push_back(it->path());
+            }
+        }
+        if (ec) {
+            std::cerr << "Error listing config directory " << directory << ": " << ec.message() << std::endl;
+            return {};
+        }
+
+        std::sort(files.begin(), files.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.filename() < rhs.filename(); });
+        return files;
+    }
+
+    // Returns nullptr if the directory is missing, unreadable or holds no "*.json" file, rather than a default Config
+    std::shared_ptr<Config> load(const std::filesystem::path& directory) const {
+        const auto files = listConfigFiles(directory);
+        if (files.empty()) {
+            std::cerr << "Error loading config directory " << directory << ": no config files found" << std::endl;
+            return nullptr;
+        }
+        return load(files);
+    }
+
+    // Files are given in ascending precedence, at least one is required
+    std::shared_ptr<Config> load(const std::vector<std::filesystem::path>& files) const {
+        if (files.empty()) return nullptr;
+
+        std::vector<MappedFile> mappedFiles(files.size());
+        std::vector<std::unique_ptr<JsonIndex>> documents(files.size());
+        std::vector<std::shared_ptr<Config>> configs(files.size());
+
+        auto parse = [&](std::size_t i) {
+            mappedFiles[i] = MappedFile(files[i]);
+            if (!mappedFiles[i].isOpen()) return;
+
+            configs[i] = m_parser.readConfig(mappedFiles[i].view());
+            if (!configs[i]) return;
+            documents[i] = std::make_unique<JsonIndex>(mappedFiles[i].view());
+            detail::mergeSetFields<Config>(nullptr, *configs[i], *documents[i], "");
+        };
+
+        if (m_executor && files.size() > 1) {
+            Concurrency::TaskGroup group;
+            for (std::size_t i = 0; i < files.size(); ++i) {
+                m_executor->submit(group, [&parse, i] { parse(i); });
+            }
+            m_executor->wait(group);
+        } else {
+            for (std::size_t i = 0; i < files.size(); ++i) parse(i);
+        }
+
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            if (!configs[i]) {
+                std::cerr << "Error reading config file " << files[i] << ": not a valid config" << std::endl;
+                return nullptr;
+            }
+        }
+
+        // The lowest precedence file starts out with defaults wherever it set nothing, exactly like a fresh Config
+        auto merged = std::move(configs.front());
+        for (std::size_t i = 1; i < files.size(); ++i) {
+            detail::mergeSetFields<Config>(merged.get(), *configs[i], *documents[i], "");
+        }
+        return merged;
+    }
+
+    // Sets the merged config once, so a ConfigPublisher publishes a single update for the whole directory
+    bool loadInto(IConfigProvider<Config>& provider, const std::filesystem::path& directory) const {
+        auto config = load(directory);
+        if (!config) return false;
+
+        provider.setConfig(std::move(config));
+        return true;
+    }
+
+   private:
+    // The calling thread works through the files as well while it waits, so one thread needs no pool
+    static std::shared_ptr<Concurrency::WorkStealingExecutor> makeExecutor(std::size_t threadCount) {
+        if (threadCount < 2) return nullptr;
+        return std::make_shared<Concurrency::WorkStealingExecutor>(
+            Concurrency::ExecutorOptions{.threadCount = threadCount - 1});
+    }
+
+   private:
+    JsonConfigParser<Config> m_parser;
+    std::shared_ptr<Concurrency::WorkStealingExecutor> m_executor;
+};
+
+}  // namespace Utils::Config
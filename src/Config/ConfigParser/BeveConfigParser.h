@@ -0,0 +1,50 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "IConfigParser.h"
+#include "StreamBuffer.h"
+#include "glaze/glaze.hpp"
+
+namespace Utils {
+namespace Config {
+
+// Reads and writes configs in glaze's binary BEVE format, meant for startup paths where JSON parsing is too slow
+template <typename Config>
+class BeveConfigParser : public IConfigParser<Config> {
+   public:
+    BeveConfigParser() { static_assert(glz::reflectable<Config>); }
+
+    std::shared_ptr<Config> readConfig(std::istream& beveStream) const override {
+        return readConfig(std::string_view(readStreamBuffer(beveStream)));
+    }
+
+    std::shared_ptr<Config> readConfig(std::string_view beve) const override {
+        auto config = std::make_shared<Config>();
+        auto ec = glz::read_beve(*config, beve);
+        if (ec) {
+            std::cerr << "Error reading BEVE config: " << static_cast<uint32_t>(ec.ec) << std::endl;
+            return nullptr;
+        }
+        return config;
+    }
+
+    int writeConfig(const Config& config, std::ostream& out) const override {
+        std::string beve;
+        auto ec = glz::write_beve(config, beve);
+        if (ec) {
+            std::cerr << "Error writing to BEVE config: " << ec << std::endl;
+        } else {
+            out.write(beve.data(), static_cast<std::streamsize>(beve.size()));
+        }
+        return ec;
+    }
+};
+
+}  // namespace Config
+}  // namespace Utils
@@ -0,0 +1,141 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BeveConfigParser.h"
+#include "ConfigSnapshot.h"
+#include "IConfigParser.h"
+#include "JsonConfigParser.h"
+#include "MappedFile.h"
+
+namespace Utils {
+namespace Config {
+
+// JSON parser that keeps a binary BEVE snapshot next to each config file it reads ("config.json.beve").
+// As long as the JSON hashes to the value stored in the snapshot and Config's schema fingerprint still matches, the
+// snapshot is loaded instead of parsing JSON, otherwise the JSON is parsed and the snapshot rewritten. Streams and views are always parsed as JSON.
+template <typename Config>
+class CachedConfigParser : public IConfigParser<Config> {
+   public:
+    std::shared_ptr<Config> readConfig(std::istream& jsonStream) const override {
+        return m_jsonParser.readConfig(jsonStream);
+    }
+
+    std::shared_ptr<Config> readConfig(std::string_view json) const override { return m_jsonParser.readConfig(json); }
+
+    int writeConfig(const Config& config, std::ostream& out) const override {
+        return m_jsonParser.writeConfig(config, out);
+    }
+
+    std::shared_ptr<Config> readConfigFile(const std::filesystem::path& jsonPath) const override {
+        const MappedFile json(jsonPath);
+        if (!json.isOpen()) return nullptr;
+
+        const auto snapshotPath = snapshotPathFor(jsonPath);
+        const auto hash = hashConfigSource(json.view());
+        if (auto config = readSnapshot(snapshotPath, hash, json.view().size())) {
+            return config;
+        }
+
+        auto config = m_jsonParser.readConfig(json.view());
+        if (config) {
+            writeSnapshot(*config, hash, json.view().size(), snapshotPath);
+        }
+        return config;
+    }
+
+    // Returns nullptr when the snapshot is missing, stale or unreadable
+    std::shared_ptr<Config> readSnapshot(const std::filesystem::path& snapshotPath, uint64_t sourceHash,
+                                         uint64_t sourceSize) const {
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(snapshotPath, ec)) return nullptr;
+
+        const MappedFile snapshot(snapshotPath);
+        const auto data = snapshot.view();
+        if (data.size() < sizeof(ConfigSnapshotHeader)) return nullptr;
+
+        ConfigSnapshotHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (header.magic != ConfigSnapshotHeader::expectedMagic || header.sourceHash != sourceHash ||
+            header.sourceSize != sourceSize || header.schemaFingerprint != configSchemaFingerprint()) {
+            return nullptr;
+        }
+
+        return m_beveParser.readConfig(data.substr(sizeof(header)));
+    }
+
+    int writeSnapshot(const Config& config, uint64_t sourceHash, uint64_t sourceSize,
+                      const std::filesystem::path& snapshotPath) const {
+        std::ostringstream payload;
+        if (int ec = m_beveParser.writeConfig(config, payload); ec != 0) {
+            return ec;
+        }
+
+        const ConfigSnapshotHeader header{
+            .sourceHash = sourceHash, .sourceSize = sourceSize, .schemaFingerprint = configSchemaFingerprint()};
+        return writeSnapshotFile(snapshotPath, header, payload.view());
+    }
+
+    // Compiles a JSON config into its snapshot ahead of time, e.g. at deploy time
+    int compileSnapshot(const std::filesystem::path& jsonPath) const {
+        const MappedFile json(jsonPath);
+        if (!json.isOpen()) return -1;
+
+        auto config = m_jsonParser.readConfig(json.view());
+        if (!config) return -1;
+
+        return writeSnapshot(*config, hashConfigSource(json.view()), json.view().size(), snapshotPathFor(jsonPath));
+    }
+
+    static uint64_t configSchemaFingerprint() {
+        static const uint64_t fingerprint = [] {
+            std::vector<std::string_view> schema;
+            describeSchema<Config>(schema);
+            return schemaFingerprint(schema);
+        }();
+        return fingerprint;
+    }
+
+   private:
+    // Flattens T into type names and field names, descending into nested structs, containers and optionals.
+    // Bounded in depth, so self-referencing types (a node holding a vector of nodes) still terminate.
+    template <typename T, std::size_t depth = 0>
+    static void describeSchema(std::vector<std::string_view>& schema) {
+        schema.push_back(glz::name_v<T>);
+        if constexpr (depth >= maxSchemaDepth || std::is_convertible_v<const T&, std::string_view>) {
+            return;
+        } else if constexpr (requires { typename T::mapped_type; }) {
+            describeSchema<typename T::key_type, depth + 1>(schema);
+            describeSchema<typename T::mapped_type, depth + 1>(schema);
+        } else if constexpr (requires { typename T::value_type; }) {
+            describeSchema<typename T::value_type, depth + 1>(schema);
+        } else if constexpr (glz::reflectable<T>) {
+            schema.push_back("{");
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                ((schema.push_back(glz::reflect<T>::keys[I]), describeSchema<glz::field_t<T, I>, depth + 1>(schema)),
+                 ...);
+            }(std::make_index_sequence<glz::reflect<T>::size>{});
+            schema.push_back("}");
+        }
+    }
+
+    static constexpr std::size_t maxSchemaDepth = 16;
+
+    JsonConfigParser<Config> m_jsonParser;
+    BeveConfigParser<Config> m_beveParser;
+};
+
+}  // namespace Config
+}  // namespace Utils
@@ -0,0 +1,36 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+#pragma once
+
+#include <iostream>
+
+#include "CachedConfigParser.h"
+
+namespace Utils {
+namespace Config {
+
+// Entry point of a config compiler tool: "<tool> <config.json>..." writes "<config.json>.beve" snapshots that
+// CachedConfigParser picks up at startup. Tools are generated per config type with utils_add_config_compiler().
+template <typename Config>
+int runConfigCompiler(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <config.json>..." << std::endl;
+        return 1;
+    }
+
+    const CachedConfigParser<Config> parser;
+    int failures = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (parser.compileSnapshot(argv[i]) != 0) {
+            std::cerr << "Failed to compile " << argv[i] << std::endl;
+            ++failures;
+        } else {
+            std::cout << argv[i] << " -> " << snapshotPathFor(argv[i]).string() << std::endl;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
+
+}  // namespace Config
+}  // namespace Utils
@@ -1,10 +1,197 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <spanstream>
+#include <utility>
+
+#include "BeveConfigParser.h"
+#include "ConfigSnapshot.h"
 #include "IConfigParser.h"
 #include "JsonConfigParser.h"
+#include "MappedFile.h"
 
 namespace Utils {
 namespace Config {
 
-// Exists to provide a compilation unit for the static library
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        std::cerr << "Error opening config file " << path << ": " << std::strerror(errno) << std::endl;
+        return;
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        std::cerr << "Error reading size of config file " << path << ": " << std::strerror(errno) << std::endl;
+        ::close(fd);
+        return;
+    }
+
+    m_size = static_cast<std::size_t>(st.st_size);
+    // mmap rejects zero-length mappings, an empty file is still a valid (empty) view
+    if (m_size > 0) {
+        void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            std::cerr << "Error mapping config file " << path << ": " << std::strerror(errno) << std::endl;
+            ::close(fd);
+            m_size = 0;
+            return;
+        }
+        ::madvise(data, m_size, MADV_SEQUENTIAL);
+        m_data = static_cast<const char*>(data);
+    }
+
+    ::close(fd);
+    m_open = true;
+}
+
+MappedFile::~MappedFile() { unmap(); }
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_open(std::exchange(other.m_open, false)),
+      m_data(std::exchange(other.m_data, nullptr)),
+      m_size(std::exchange(other.m_size, 0)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        m_open = std::exchange(other.m_open, false);
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+bool MappedFile::isOpen() const { return m_open; }
+
+std::string_view MappedFile::view() const { return {m_data, m_size}; }
+
+void MappedFile::unmap() {
+    if (m_data != nullptr) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+    m_open = false;
+    m_data = nullptr;
+    m_size = 0;
+}
+
+namespace detail {
+
+void readThroughStream(std::string_view data, const std::function<void(std::istream&)>& read) {
+    std::ispanstream stream(std::span<const char>(data.data(), data.size()));
+    read(stream);
+}
+
+void readMappedFile(const std::filesystem::path& path, const std::function<void(std::string_view)>& read) {
+    const MappedFile file(path);
+    if (file.isOpen()) read(file.view());
+}
+
+}  // namespace detail
+
+namespace {
+
+constexpr uint64_t hashMultiplier = 0x9E3779B97F4A7C15ULL;
+
+// Final avalanche of MurmurHash3
+constexpr uint64_t mix(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+}  // namespace
+
+uint64_t hashConfigSource(std::string_view source) {
+    // Four independent lanes of 8-byte words keep the multiplies pipelined, so hashing runs close to memory bandwidth
+    std::array<uint64_t, 4> lanes = {hashMultiplier, hashMultiplier ^ 1, hashMultiplier ^ 2, hashMultiplier ^ 3};
+    const char* data = source.data();
+    std::size_t remaining = source.size();
+
+    while (remaining >= sizeof(uint64_t) * lanes.size()) {
+        for (auto& lane : lanes) {
+            uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            lane = std::rotl(lane ^ (word * hashMultiplier), 31) * hashMultiplier;
+            data += sizeof(word);
+        }
+        remaining -= sizeof(uint64_t) * lanes.size();
+    }
+
+    uint64_t hash = source.size();
+    for (const auto lane : lanes) {
+        hash = mix(hash ^ lane);
+    }
+    for (; remaining > 0; --remaining, ++data) {
+        hash = (hash ^ static_cast<unsigned char>(*data)) * hashMultiplier;
+    }
+    return mix(hash);
+}
+
+uint64_t schemaFingerprint(std::span<const std::string_view> schema) {
+    uint64_t fingerprint = mix(hashConfigSource(UTILS_GLAZE_VERSION));
+    for (const auto part : schema) {
+        // Chained so reordering fields changes the fingerprint as well, BEVE structs are written in field order
+        fingerprint = mix(fingerprint * hashMultiplier ^ hashConfigSource(part));
+    }
+    return fingerprint;
+}
+
+int writeSnapshotFile(const std::filesystem::path& snapshotPath, const ConfigSnapshotHeader& header,
+                      std::string_view payload) {
+    // Unique per writer, concurrent processes compiling the same snapshot would otherwise interleave their bytes
+    std::string tmpPath = snapshotPath.string() + ".XXXXXX";
+    const int fd = ::mkstemp(tmpPath.data());
+    if (fd < 0) {
+        std::cerr << "Error creating config snapshot " << tmpPath << ": " << std::strerror(errno) << std::endl;
+        return -1;
+    }
+    // mkstemp() creates the file readable by its owner only, snapshots are as readable as the configs next to them
+    ::fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+    const auto writeAll = [fd](const char* data, std::size_t size) {
+        while (size > 0) {
+            const auto written = ::write(fd, data, size);
+            if (written < 0 && errno == EINTR) continue;
+            if (written <= 0) return false;
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+        return true;
+    };
+    const bool written = writeAll(reinterpret_cast<const char*>(&header), sizeof(header)) &&
+                         writeAll(payload.data(), payload.size());
+    if (::close(fd) != 0 || !written) {
+        std::cerr << "Error writing config snapshot " << tmpPath << ": " << std::strerror(errno) << std::endl;
+        ::unlink(tmpPath.c_str());
+        return -1;
+    }
+
+    if (::rename(tmpPath.c_str(), snapshotPath.c_str()) != 0) {
+        std::cerr << "Error writing config snapshot " << snapshotPath << ": " << std::strerror(errno) << std::endl;
+        ::unlink(tmpPath.c_str());
+        return -1;
+    }
+    return 0;
+}
+
+std::filesystem::path snapshotPathFor(const std::filesystem::path& sourcePath) {
+    auto snapshotPath = sourcePath;
+    snapshotPath += ".beve";
+    return snapshotPath;
+}
 
 }  // namespace Config
 }  // namespace Utils
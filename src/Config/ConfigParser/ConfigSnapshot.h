@@ -0,0 +1,43 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+
+namespace Utils::Config {
+
+// Prefix of a binary config snapshot, ties the BEVE payload that follows it to the exact JSON it was compiled from
+// and to the layout of the config type that wrote it
+struct ConfigSnapshotHeader {
+    static constexpr std::array<char, 8> expectedMagic = {'U', 'T', 'L', 'B', 'E', 'V', 'E', '2'};
+
+    std::array<char, 8> magic = expectedMagic;
+    uint64_t sourceHash = 0;
+    uint64_t sourceSize = 0;
+    uint64_t schemaFingerprint = 0;
+};
+
+// Fast non-cryptographic 64-bit hash, only used to detect that a JSON config changed since its snapshot was written
+uint64_t hashConfigSource(std::string_view source);
+
+// Hash of a config type's schema, as flattened by the parser: type names, field names and the types of the fields,
+// nested structs included, plus the glaze version. Snapshots written before a field was added, removed, renamed or
+// retyped (or by another glaze release) are rebuilt instead of silently missing values.
+uint64_t schemaFingerprint(std::span<const std::string_view> schema);
+
+// Replaces snapshotPath with the header followed by the payload. Written to a uniquely named file next to it first and
+// renamed into place, so neither readers nor other processes writing the same snapshot see a half-written file.
+// Returns 0 on success.
+int writeSnapshotFile(const std::filesystem::path& snapshotPath, const ConfigSnapshotHeader& header,
+                      std::string_view payload);
+
+// "config.json" -> "config.json.beve"
+std::filesystem::path snapshotPathFor(const std::filesystem::path& sourcePath);
+
+}  // namespace Utils::Config
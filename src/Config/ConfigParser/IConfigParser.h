@@ -3,8 +3,19 @@
 //
 
 #pragma once
+#include <filesystem>
+#include <functional>
 #include <iosfwd>
 #include <memory>
+#include <string_view>
+
+namespace Utils::Config::detail {
+
+// Defined in ConfigParser.cpp, so the interface does not pull in <spanstream> or the file mapping
+void readThroughStream(std::string_view data, const std::function<void(std::istream&)>& read);
+void readMappedFile(const std::filesystem::path& path, const std::function<void(std::string_view)>& read);
+
+}  // namespace Utils::Config::detail
 
 template <typename Config>
 class IConfigParser {
@@ -13,4 +24,17 @@ class IConfigParser {
 
     virtual std::shared_ptr<Config> readConfig(std::istream& stream) const = 0;
     virtual int writeConfig(const Config& config, std::ostream& out) const = 0;
-};
\ No newline at end of file
+
+    // Parsers that can work on contiguous memory directly should override this to skip the stream
+    virtual std::shared_ptr<Config> readConfig(std::string_view data) const {
+        std::shared_ptr<Config> config;
+        Utils::Config::detail::readThroughStream(data, [&](std::istream& stream) { config = readConfig(stream); });
+        return config;
+    }
+
+    virtual std::shared_ptr<Config> readConfigFile(const std::filesystem::path& path) const {
+        std::shared_ptr<Config> config;
+        Utils::Config::detail::readMappedFile(path, [&](std::string_view data) { config = readConfig(data); });
+        return config;
+    }
+};
@@ -5,8 +5,10 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 
 #include "IConfigParser.h"
+#include "StreamBuffer.h"
 #include "glaze/glaze.hpp"
 
 namespace Utils {
@@ -17,26 +19,31 @@ class JsonConfigParser : public IConfigParser<Config> {
    public:
     JsonConfigParser() { static_assert(glz::reflectable<Config>); }
 
-    std::shared_ptr<Config> readConfig(std::istream& jsonStream) const {
-        std::string json((std::istreambuf_iterator<char>(jsonStream)), std::istreambuf_iterator<char>());
+    std::shared_ptr<Config> readConfig(std::istream& jsonStream) const override {
+        // Resizable buffer lets glaze pad it and use its fastest parse path
+        std::string& json = readStreamBuffer(jsonStream);
 
-        Config config;
-        auto ec = glz::read_json(config, json);
+        auto config = std::make_shared<Config>();
+        auto ec = glz::read_json(*config, json);
         if (ec) {
-            // Fix: Correct error message for reading (not writing)
-            std::cerr << "Error reading JSON config: " << static_cast<uint32_t>(ec);
-
-            if (ec == glz::error_code::unknown_key) {
-                std::cerr << " (unknown_key - JSON contains fields not in struct)";
-            }
+            reportReadError(ec);
+            return nullptr;
+        }
+        return config;
+    }
 
-            std::cerr << std::endl;
+    std::shared_ptr<Config> readConfig(std::string_view json) const override {
+        // Parses in place, the view (e.g. a mapped file) is neither copied nor required to be null terminated
+        auto config = std::make_shared<Config>();
+        auto ec = glz::read<glz::opts{.null_terminated = false}>(*config, json);
+        if (ec) {
+            reportReadError(ec);
             return nullptr;
         }
-        return std::make_shared<Config>(config);
+        return config;
     }
 
-    int writeConfig(const Config& config, std::ostream& out) const {
+    int writeConfig(const Config& config, std::ostream& out) const override {
         std::string json;
         auto ec = glz::write_json(config, json);
         if (ec) {
@@ -46,7 +53,18 @@ class JsonConfigParser : public IConfigParser<Config> {
         }
         return ec;
     }
+
+   private:
+    static void reportReadError(const glz::error_ctx& ec) {
+        std::cerr << "Error reading JSON config: " << static_cast<uint32_t>(ec.ec);
+
+        if (ec == glz::error_code::unknown_key) {
+            std::cerr << " (unknown_key - JSON contains fields not in struct)";
+        }
+
+        std::cerr << std::endl;
+    }
 };
 
 }  // namespace Config
-}  // namespace Utils
\ No newline at end of file
+}  // namespace Utils
@@ -0,0 +1,267 @@
+#include "JsonIndex.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace Utils::Config {
+
+namespace {
+
+constexpr std::size_t npos = std::string_view::npos;
+
+constexpr bool isWhitespace(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+std::size_t skipWhitespace(std::string_view json, std::size_t pos) {
+    while (pos < json.size() && isWhitespace(json[pos])) ++pos;
+    return pos;
+}
+
+// pos is at the opening quote, returns the position right after the closing one
+std::size_t skipString(std::string_view json, std::size_t pos) {
+    ++pos;
+    while (pos < json.size()) {
+        const char c = json[pos];
+        if (c == '"') return pos + 1;
+        pos += c == '\\' ? 2 : 1;
+    }
+    return npos;
+}
+
+// Only finds where a value ends, validating its contents is left to the parser that later reads it
+std::size_t skipValue(std::string_view json, std::size_t pos) {
+    if (pos >= json.size()) return npos;
+
+    const char first = json[pos];
+    if (first == '"') return skipString(json, pos);
+
+    if (first == '{' || first == '[') {
+        std::size_t depth = 0;
+        while (pos < json.size()) {
+            const char c = json[pos];
+            if (c == '"') {
+                pos = skipString(json, pos);
+                if (pos == npos) return npos;
+                continue;
+            }
+            if (c == '{' || c == '[') {
+                ++depth;
+            } else if (c == '}' || c == ']') {
+                if (--depth == 0) return pos + 1;
+            }
+            ++pos;
+        }
+        return npos;
+    }
+
+    const std::size_t begin = pos;
+    while (pos < json.size() && !isWhitespace(json[pos]) && json[pos] != ',' && json[pos] != '}' &&
+           json[pos] != ']') {
+        ++pos;
+    }
+    return pos == begin ? npos : pos;
+}
+
+void appendUtf8(std::string& out, uint32_t codePoint) {
+    if (codePoint < 0x80) {
+        out += static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+        out += static_cast<char>(0xC0 | (codePoint >> 6));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        out += static_cast<char>(0xE0 | (codePoint >> 12));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (codePoint >> 18));
+        out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+std::optional<uint32_t> parseHex4(std::string_view text, std::size_t pos) {
+    if (pos + 4 > text.size()) return std::nullopt;
+
+    uint32_t value = 0;
+    for (std::size_t i = pos; i < pos + 4; ++i) {
+        const char c = text[i];
+        value <<= 4;
+        if (c >= '0' && c <= '9') {
+            value |= static_cast<uint32_t>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            value |= static_cast<uint32_t>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            value |= static_cast<uint32_t>(c - 'A' + 10);
+        } else {
+            return std::nullopt;
+        }
+    }
+    return value;
+}
+
+// Decodes the contents of a JSON string (without the quotes)
+std::optional<std::string> decodeString(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    for (std::size_t pos = 0; pos < text.size(); ++pos) {
+        if (text[pos] != '\\') {
+            out += text[pos];
+            continue;
+        }
+        if (++pos >= text.size()) return std::nullopt;
+
+        switch (text[pos]) {
+            case '"':
+            case '\\':
+            case '/':
+                out += text[pos];
+                break;
+            case 'b':
+                out += '\b';
+                break;
+            case 'f':
+                out += '\f';
+                break;
+            case 'n':
+                out += '\n';
+                break;
+            case 'r':
+                out += '\r';
+                break;
+            case 't':
+                out += '\t';
+                break;
+            case 'u': {
+                auto codePoint = parseHex4(text, pos + 1);
+                if (!codePoint) return std::nullopt;
+                pos += 4;
+                if (*codePoint >= 0xD800 && *codePoint <= 0xDBFF) {
+                    if (pos + 2 >= text.size() || text[pos + 1] != '\\' || text[pos + 2] != 'u') return std::nullopt;
+                    const auto low = parseHex4(text, pos + 3);
+                    if (!low || *low < 0xDC00 || *low > 0xDFFF) return std::nullopt;
+                    codePoint = 0x10000 + ((*codePoint - 0xD800) << 10) + (*low - 0xDC00);
+                    pos += 6;
+                }
+                appendUtf8(out, *codePoint);
+                break;
+            }
+            default:
+                return std::nullopt;
+        }
+    }
+    return out;
+}
+
+}  // namespace
+
+JsonIndex::JsonIndex(std::string_view document) {
+    const std::size_t begin = skipWhitespace(document, 0);
+    const std::size_t end = skipValue(document, begin);
+    if (end != npos && skipWhitespace(document, end) == document.size()) {
+        m_root = document.substr(begin, end - begin);
+    }
+}
+
+std::optional<std::string_view> JsonIndex::find(std::string_view pointer) {
+    if (!m_root) return std::nullopt;
+    if (pointer.empty()) return m_root;
+    if (pointer.front() != '/') return std::nullopt;
+
+    std::string current;
+    std::string_view value = *m_root;
+    std::size_t tokenBegin = 1;
+    while (tokenBegin <= pointer.size()) {
+        if (!m_children.contains(current) && !indexContainer(current, value)) return std::nullopt;
+
+        const std::size_t tokenEnd = std::min(pointer.find('/', tokenBegin), pointer.size());
+        current.assign(pointer.substr(0, tokenEnd));
+
+        const auto it = m_values.find(current);
+        if (it == m_values.end()) return std::nullopt;
+
+        value = it->second;
+        tokenBegin = tokenEnd + 1;
+    }
+    return value;
+}
+
+std::optional<std::vector<std::string>> JsonIndex::keys(std::string_view pointer) {
+    const auto value = find(pointer);
+    if (!value) return std::nullopt;
+
+    std::string key(pointer);
+    if (!m_children.contains(key) && !indexContainer(key, *value)) return std::nullopt;
+    return m_children.at(key);
+}
+
+std::string JsonIndex::escapeToken(std::string_view token) {
+    std::string escaped;
+    escaped.reserve(token.size());
+    for (const char c : token) {
+        if (c == '~') {
+            escaped += "~0";
+        } else if (c == '/') {
+            escaped += "~1";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+bool JsonIndex::indexContainer(const std::string& pointer, std::string_view value) {
+    if (value.empty() || (value.front() != '{' && value.front() != '[')) return false;
+
+    const bool isObject = value.front() == '{';
+    const char close = isObject ? '}' : ']';
+    std::vector<std::pair<std::string, std::string_view>> children;
+
+    std::size_t pos = skipWhitespace(value, 1);
+    if (pos < value.size() && value[pos] == close) {
+        m_children.emplace(pointer, std::vector<std::string>{});
+        return true;
+    }
+
+    while (pos < value.size()) {
+        std::string token;
+        if (isObject) {
+            if (value[pos] != '"') return false;
+            const std::size_t keyEnd = skipString(value, pos);
+            if (keyEnd == npos) return false;
+            const auto key = decodeString(value.substr(pos + 1, keyEnd - pos - 2));
+            if (!key) return false;
+            token = escapeToken(*key);
+
+            pos = skipWhitespace(value, keyEnd);
+            if (pos >= value.size() || value[pos] != ':') return false;
+            pos = skipWhitespace(value, pos + 1);
+        } else {
+            token = std::to_string(children.size());
+        }
+
+        const std::size_t valueEnd = skipValue(value, pos);
+        if (valueEnd == npos) return false;
+        children.emplace_back(std::move(token), value.substr(pos, valueEnd - pos));
+
+        pos = skipWhitespace(value, valueEnd);
+        if (pos >= value.size()) return false;
+        if (value[pos] == close) break;
+        if (value[pos] != ',') return false;
+        pos = skipWhitespace(value, pos + 1);
+    }
+    if (pos >= value.size()) return false;
+
+    auto& tokens = m_children[pointer];
+    tokens.reserve(children.size());
+    for (auto& [token, childValue] : children) {
+        // Duplicate keys resolve to the last occurrence, like a parser reading the object would
+        auto [it, inserted] = m_values.insert_or_assign(pointer + "/" + token, childValue);
+        if (inserted) {
+            tokens.push_back(std::move(token));
+        }
+    }
+    return true;
+}
+
+}  // namespace Utils::Config
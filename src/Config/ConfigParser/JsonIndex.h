@@ -0,0 +1,41 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Utils::Config {
+
+// Locates values of a raw JSON document by JSON pointer (RFC 6901, e.g. "/logging/levels/0") without parsing them.
+// Containers are indexed lazily: the direct children of an object or array are scanned once, the first time a
+// pointer goes through it, so the cost follows the paths actually looked up rather than the document size.
+// The document must outlive the index. Not thread safe.
+class JsonIndex {
+   public:
+    explicit JsonIndex(std::string_view document);
+
+    // Raw text of the value at the pointer, "" addresses the whole document.
+    // Returns std::nullopt when the pointer does not resolve or the document is malformed along its path.
+    std::optional<std::string_view> find(std::string_view pointer);
+
+    // Child tokens of an object or array as JSON pointer tokens ("~0"/"~1" escaped), in document order
+    std::optional<std::vector<std::string>> keys(std::string_view pointer);
+
+    static std::string escapeToken(std::string_view token);
+
+   private:
+    bool indexContainer(const std::string& pointer, std::string_view value);
+
+   private:
+    std::optional<std::string_view> m_root;
+    std::unordered_map<std::string, std::string_view> m_values;
+    std::unordered_map<std::string, std::vector<std::string>> m_children;
+};
+
+}  // namespace Utils::Config
@@ -0,0 +1,98 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+#pragma once
+
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <utility>
+
+#include "JsonIndex.h"
+#include "MappedFile.h"
+#include "glaze/glaze.hpp"
+
+namespace Utils {
+namespace Config {
+
+// Read-only view over a large JSON config that deserializes only the sub-trees components ask for.
+// get<T>("/logging/levels") parses that value into T the first time it is requested and caches the result, so
+// memory and parse time follow what is read rather than the size of the document. Thread safe.
+class LazyConfigView {
+   public:
+    explicit LazyConfigView(std::string document) : m_owned(std::move(document)), m_index(m_owned) {}
+
+    explicit LazyConfigView(MappedFile file) : m_file(std::move(file)), m_index(m_file.view()) {}
+
+    LazyConfigView(const LazyConfigView&) = delete;
+    LazyConfigView& operator=(const LazyConfigView&) = delete;
+
+    static std::shared_ptr<LazyConfigView> fromFile(const std::filesystem::path& path) {
+        MappedFile file(path);
+        if (!file.isOpen()) return nullptr;
+        return std::make_shared<LazyConfigView>(std::move(file));
+    }
+
+    // Returns nullptr when the pointer does not resolve or the value doesn't deserialize into T
+    template <typename T>
+    std::shared_ptr<const T> get(std::string_view pointer) const {
+        std::string_view json;
+        {
+            std::lock_guard lock(m_mutex);
+            if (const auto it = m_cache.find({std::string(pointer), typeid(T)}); it != m_cache.end()) {
+                return std::static_pointer_cast<const T>(it->second);
+            }
+
+            const auto raw = m_index.find(pointer);
+            if (!raw) {
+                std::cerr << "Error reading lazy config: no value at \"" << pointer << "\"" << std::endl;
+                return nullptr;
+            }
+            json = *raw;
+        }
+
+        // Parsed outside the lock so a large sub-tree doesn't block other components reading theirs
+        auto value = std::make_shared<T>();
+        auto ec = glz::read<glz::opts{.null_terminated = false}>(*value, json);
+        if (ec) {
+            std::cerr << "Error reading lazy config at \"" << pointer << "\": " << static_cast<uint32_t>(ec.ec)
+                      << std::endl;
+            return nullptr;
+        }
+
+        std::lock_guard lock(m_mutex);
+        // If another thread parsed the same value meanwhile, keep the first so every caller shares one instance
+        auto [it, inserted] = m_cache.try_emplace({std::string(pointer), typeid(T)}, std::move(value));
+        return std::static_pointer_cast<const T>(it->second);
+    }
+
+    // Raw JSON text at the pointer, without deserializing it
+    std::optional<std::string_view> raw(std::string_view pointer) const {
+        std::lock_guard lock(m_mutex);
+        return m_index.find(pointer);
+    }
+
+    bool contains(std::string_view pointer) const { return raw(pointer).has_value(); }
+
+    std::size_t getCachedCount() const {
+        std::lock_guard lock(m_mutex);
+        return m_cache.size();
+    }
+
+   private:
+    std::string m_owned;
+    MappedFile m_file;
+
+    mutable std::mutex m_mutex;
+    mutable JsonIndex m_index;
+    mutable std::map<std::pair<std::string, std::type_index>, std::shared_ptr<const void>> m_cache;
+};
+
+}  // namespace Config
+}  // namespace Utils
@@ -0,0 +1,37 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace Utils::Config {
+
+// Read-only memory mapping of a whole file, used to parse configs without copying them into a stream buffer first.
+class MappedFile {
+   public:
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool isOpen() const;
+    std::string_view view() const;
+
+   private:
+    void unmap();
+
+   private:
+    bool m_open = false;
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+};
+
+}  // namespace Utils::Config
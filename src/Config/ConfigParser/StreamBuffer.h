@@ -0,0 +1,34 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <string>
+
+namespace Utils::Config {
+
+// Drains the stream in bulk into a buffer reused per thread, so repeated reloads don't reallocate.
+// The buffer is only valid until the next call, which gives the memory back if the last config was unusually large.
+inline std::string& readStreamBuffer(std::istream& stream) {
+    static constexpr std::size_t chunkSize = 64 * 1024;
+    static constexpr std::size_t keptCapacity = 4 * 1024 * 1024;
+    thread_local std::string buffer;
+
+    if (buffer.capacity() > keptCapacity) {
+        std::string().swap(buffer);
+    }
+    buffer.clear();
+    std::size_t size = 0;
+    while (stream) {
+        buffer.resize(size + chunkSize);
+        stream.read(buffer.data() + size, chunkSize);
+        size += static_cast<std::size_t>(stream.gcount());
+    }
+    buffer.resize(size);
+    return buffer;
+}
+
+}  // namespace Utils::Config
@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <filesystem>
 #include <memory>
 #include <mutex>
 
+#include "ConfigParser/IConfigParser.h"
+
 namespace Utils {
 namespace Config {
 
@@ -25,6 +28,15 @@ class IConfigProvider {
         return m_config;
     }
 
+    // Pass a CachedConfigParser to load from the file's binary snapshot whenever it is up to date
+    bool loadConfigFile(const IConfigParser<Config>& parser, const std::filesystem::path& path) {
+        auto config = parser.readConfigFile(path);
+        if (!config) return false;
+
+        setConfig(std::move(config));
+        return true;
+    }
+
    protected:
     mutable std::mutex m_mutex;
     std::shared_ptr<Config> m_config;
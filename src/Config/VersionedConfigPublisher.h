@@ -0,0 +1,128 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "ConfigManagers.h"
+
+namespace Utils::Config {
+
+template <typename Config>
+class VersionedConfigPublisher;
+
+// Pins one config version for as long as the handle lives, so a task can do several reads against the same
+// version even if the publisher moves on. Copying a handle is a reference count increment, no locks involved.
+template <typename Config>
+class ConfigSnapshot {
+   public:
+    ConfigSnapshot() = default;
+
+    uint64_t getVersion() const { return m_entry ? m_entry->version : 0; }
+    std::shared_ptr<const Config> getConfig() const { return m_entry ? m_entry->config : nullptr; }
+
+    const Config& operator*() const { return *m_entry->config; }
+    const Config* operator->() const { return m_entry->config.get(); }
+    explicit operator bool() const { return m_entry && m_entry->config; }
+
+   private:
+    friend class VersionedConfigPublisher<Config>;
+
+    struct Entry {
+        uint64_t version;
+        std::shared_ptr<const Config> config;
+    };
+
+    explicit ConfigSnapshot(std::shared_ptr<const Entry> entry) : m_entry(std::move(entry)) {}
+
+    std::shared_ptr<const Entry> m_entry;
+};
+
+// ConfigPublisher that numbers every config it receives (1, 2, 3, ...) and keeps the last `historySize` of them in a
+// ring, so a bad reload can be undone with rollback(version) without re-reading anything. Readers get the current
+// config or pin() a snapshot lock-free. A config is freed as soon as it has left the ring and nobody pins it.
+// Versions are published in the order they are numbered, so setConfig() and rollback() must not be called from a
+// subscriber's onUpdate().
+template <typename Config>
+class VersionedConfigPublisher : public ConfigPublisher<Config> {
+    using Entry = typename ConfigSnapshot<Config>::Entry;
+
+   public:
+    explicit VersionedConfigPublisher(std::size_t historySize = 16) : m_history(historySize > 0 ? historySize : 1) {}
+
+    ~VersionedConfigPublisher() override = default;
+
+    void setConfig(std::shared_ptr<Config> config) override {
+        std::lock_guard publishLock(m_publishMutex);
+        {
+            std::lock_guard lock(m_historyMutex);
+            auto entry = std::make_shared<const Entry>(Entry{++m_latestVersion, config});
+            m_history[entry->version % m_history.size()] = entry;
+            m_current.store(std::move(entry));
+        }
+        this->publish(config);
+    }
+
+    // IConfigProvider and the subscribers predate const configs, they get the same object and must not modify it
+    std::shared_ptr<Config> getConfig() const override { return std::const_pointer_cast<Config>(pin().getConfig()); }
+
+    ConfigSnapshot<Config> pin() const { return ConfigSnapshot<Config>(m_current.load()); }
+
+    // Snapshot of a version still in the history, or an empty one if it was never published or already evicted
+    ConfigSnapshot<Config> getSnapshot(uint64_t version) const {
+        std::lock_guard lock(m_historyMutex);
+        return ConfigSnapshot<Config>(findEntry(version));
+    }
+
+    // Makes a version from the history current again and republishes it. Versions are not renumbered, the next
+    // setConfig() still continues from getLatestVersion().
+    bool rollback(uint64_t version) {
+        std::lock_guard publishLock(m_publishMutex);
+        std::shared_ptr<const Entry> entry;
+        {
+            std::lock_guard lock(m_historyMutex);
+            entry = findEntry(version);
+            if (!entry) return false;
+            m_current.store(entry);
+        }
+        this->publish(std::const_pointer_cast<Config>(entry->config));
+        return true;
+    }
+
+    uint64_t getCurrentVersion() const { return pin().getVersion(); }
+
+    uint64_t getLatestVersion() const {
+        std::lock_guard lock(m_historyMutex);
+        return m_latestVersion;
+    }
+
+    std::size_t getHistorySize() const { return m_history.size(); }
+
+   private:
+    std::shared_ptr<const Entry> findEntry(uint64_t version) const {
+        if (version == 0) return nullptr;
+
+        const auto& entry = m_history[version % m_history.size()];
+        return entry && entry->version == version ? entry : nullptr;
+    }
+
+   private:
+    std::atomic<std::shared_ptr<const Entry>> m_current;
+
+    // Held from numbering a version until it is published, so subscribers see versions in order
+    std::mutex m_publishMutex;
+
+    mutable std::mutex m_historyMutex;
+    std::vector<std::shared_ptr<const Entry>> m_history;
+    uint64_t m_latestVersion = 0;
+};
+
+}  // namespace Utils::Config
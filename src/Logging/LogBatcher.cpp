@@ -0,0 +1,232 @@
+#include "LogBatcher.h"
+
+#include <spdlog/sinks/sink.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+namespace Utils::Logging {
+
+namespace {
+
+std::atomic<std::uint64_t> s_nextBatcherId{1};
+
+struct LiveBatchers {
+    std::mutex mutex;
+    std::vector<LogBatcher*> batchers;
+};
+
+// Never destroyed: the exit and signal paths may run after static objects are torn down
+LiveBatchers& liveBatchers() {
+    static auto* s_liveBatchers = new LiveBatchers();
+    return *s_liveBatchers;
+}
+
+}  // namespace
+
+LogBatcher::LogBatcher(std::shared_ptr<spdlog::logger> logger, std::size_t batchSize,
+                       std::chrono::milliseconds flushInterval)
+    : m_id(s_nextBatcherId.fetch_add(1, std::memory_order_relaxed)),
+      m_logger(std::move(logger)),
+      m_batchSize(std::max<std::size_t>(batchSize, 2)),
+      m_flushInterval(flushInterval),
+      m_writer([this](std::stop_token token) { run(std::move(token)); }) {
+    auto& live = liveBatchers();
+    std::lock_guard lock(live.mutex);
+    live.batchers.push_back(this);
+}
+
+LogBatcher::~LogBatcher() {
+    {
+        auto& live = liveBatchers();
+        std::lock_guard lock(live.mutex);
+        std::erase(live.batchers, this);
+    }
+    m_writer.request_stop();
+    m_writer.join();
+    flush();
+
+    std::lock_guard lock(m_buffersMutex);
+    for (const auto& buffer : m_buffers) {
+        buffer->closed.store(true, std::memory_order_release);
+    }
+}
+
+void LogBatcher::stage(spdlog::level::level_enum level, std::string_view message) {
+    auto& buffer = threadBuffer();
+    // Announced before the timestamp is taken, with the previous one as the bound: a drain that misses this record
+    // still holds back newer ones, and the record needs a single clock read
+    buffer.stagingSince.store(buffer.lastStamp, std::memory_order_relaxed);
+    Record record{spdlog::log_clock::now(), level, buffer.threadId, std::string(message)};
+    buffer.lastStamp = record.time.time_since_epoch().count();
+    if (!buffer.records.tryPush(std::move(record))) {
+        // Full ring: ask for a drain once, then back off until the writer made room
+        wakeWriter();
+        for (int attempt = 0; !buffer.records.tryPush(std::move(record)); ++attempt) {
+            if (attempt < 64) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+    }
+    buffer.stagingSince.store(ThreadBuffer::idle, std::memory_order_release);
+
+    // Errors often precede a crash, they and everything before them must already be in the sinks by then
+    if (level >= spdlog::level::err) {
+        flush();
+        return;
+    }
+
+    // Hand the batch over once the ring is half full, so producers rarely have to wait for the writer
+    if (++buffer.staged % (buffer.records.capacity() / 2) == 0) {
+        wakeWriter();
+    }
+}
+
+void LogBatcher::flush() {
+    std::lock_guard lock(m_writeMutex);
+    drain(true);
+    m_logger->flush();
+}
+
+void LogBatcher::flushAll() {
+    auto& live = liveBatchers();
+    std::lock_guard liveLock(live.mutex);
+    for (auto* batcher : live.batchers) {
+        batcher->flush();
+    }
+}
+
+void LogBatcher::updateSinks(const std::function<void(std::vector<spdlog::sink_ptr>&)>& update) {
+    std::lock_guard lock(m_writeMutex);
+    drain(true);
+    update(m_logger->sinks());
+}
+
+LogBatcher::ThreadBuffer& LogBatcher::threadBuffer() {
+    // Buffers outlive both sides: the thread keeps its own until it exits, the batcher until it has drained it
+    struct ThreadBuffers {
+        ~ThreadBuffers() {
+            for (auto& [id, buffer] : byBatcher) buffer->orphaned.store(true, std::memory_order_release);
+        }
+
+        std::unordered_map<std::uint64_t, std::shared_ptr<ThreadBuffer>> byBatcher;
+    };
+    thread_local ThreadBuffers t_buffers;
+    thread_local std::uint64_t t_lastId = 0;
+    thread_local ThreadBuffer* t_lastBuffer = nullptr;
+
+    if (t_lastId == m_id) return *t_lastBuffer;
+
+    // Batcher ids are never reused, so buffers of destroyed batchers would only pile up
+    std::erase_if(t_buffers.byBatcher,
+                  [](const auto& entry) { return entry.second->closed.load(std::memory_order_acquire); });
+
+    auto& buffer = t_buffers.byBatcher[m_id];
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>(m_batchSize);
+        std::lock_guard lock(m_buffersMutex);
+        m_buffers.push_back(buffer);
+    }
+    t_lastId = m_id;
+    t_lastBuffer = buffer.get();
+    return *buffer;
+}
+
+void LogBatcher::wakeWriter() {
+    if (m_wakeRequested.exchange(true, std::memory_order_acq_rel)) return;
+    // Empty critical section: the writer either sees the request before it waits or gets the notification
+    { std::lock_guard lock(m_wakeMutex); }
+    m_wake.notify_one();
+}
+
+void LogBatcher::run(std::stop_token token) {
+    while (!token.stop_requested()) {
+        {
+            std::unique_lock lock(m_wakeMutex);
+            m_wake.wait_for(lock, token, m_flushInterval,
+                            [this] { return m_wakeRequested.load(std::memory_order_acquire); });
+            m_wakeRequested.store(false, std::memory_order_release);
+        }
+
+        std::lock_guard lock(m_writeMutex);
+        drain(false);
+    }
+}
+
+void LogBatcher::drain(bool force) {
+    // Records staged from here on are stamped later than now, unless their producer announced an earlier bound,
+    // so everything older than the watermark is final and can be written in timestamp order. Taken before the
+    // buffers are listed: a buffer registered after the listing only holds records newer than the watermark.
+    using TimePoint = spdlog::log_clock::time_point;
+    auto watermark = force ? TimePoint::max() : spdlog::log_clock::now();
+    {
+        std::lock_guard lock(m_buffersMutex);
+        m_draining = m_buffers;
+    }
+    if (!force) {
+        for (const auto& buffer : m_draining) {
+            const auto since = buffer->stagingSince.load(std::memory_order_acquire);
+            watermark = std::min(watermark, TimePoint(TimePoint::duration(since)));
+        }
+    }
+
+    // Take at most one ring's worth per buffer, so a busy producer cannot keep the writer here forever
+    for (const auto& buffer : m_draining) {
+        auto& records = buffer->records;
+        auto& pending = buffer->pending;
+        for (std::size_t taken = 0; taken < records.capacity(); ++taken) {
+            Record record;
+            if (!records.tryPop(record)) break;
+            pending.push_back(std::move(record));
+        }
+        if (const auto* head = records.front(); head != nullptr && !force) {
+            watermark = std::min(watermark, head->time);
+        }
+    }
+
+    // Every buffer is already ordered, k-way merge them by timestamp up to the watermark
+    using Cursor = std::pair<TimePoint, std::size_t>;
+    std::priority_queue<Cursor, std::vector<Cursor>, std::greater<>> heads;
+    std::vector<std::size_t> positions(m_draining.size(), 0);
+    for (std::size_t i = 0; i < m_draining.size(); ++i) {
+        const auto& pending = m_draining[i]->pending;
+        if (!pending.empty()) heads.emplace(pending.front().time, i);
+    }
+    while (!heads.empty() && (force || heads.top().first < watermark)) {
+        const auto index = heads.top().second;
+        heads.pop();
+
+        const auto& pending = m_draining[index]->pending;
+        write(pending[positions[index]]);
+        if (++positions[index] < pending.size()) heads.emplace(pending[positions[index]].time, index);
+    }
+    for (std::size_t i = 0; i < m_draining.size(); ++i) {
+        auto& pending = m_draining[i]->pending;
+        pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(positions[i]));
+    }
+
+    {
+        std::lock_guard lock(m_buffersMutex);
+        std::erase_if(m_buffers, [](const std::shared_ptr<ThreadBuffer>& buffer) {
+            return buffer->orphaned.load(std::memory_order_acquire) && buffer->records.empty() &&
+                   buffer->pending.empty();
+        });
+    }
+    m_draining.clear();
+}
+
+void LogBatcher::write(const Record& record) {
+    spdlog::details::log_msg message(record.time, spdlog::source_loc{}, m_logger->name(), record.level,
+                                     record.payload);
+    message.thread_id = record.threadId;
+    for (const auto& sink : m_logger->sinks()) {
+        if (sink->should_log(message.level)) sink->log(message);
+    }
+}
+
+}  // namespace Utils::Logging
@@ -0,0 +1,110 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <spdlog/details/os.h>
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Concurrency/SPSCQueue.h"
+
+namespace Utils::Logging {
+
+// Batched front-end of a Logger. Every thread that logs gets its own staging ring, created lazily on its first
+// record, so producers never contend with each other. A writer thread drains all rings when one of them fills up,
+// every flushInterval and on flush(), merges the records by timestamp and writes them straight into the sinks with
+// their original time and thread id. Records newer than one a producer may still be staging are held back until a
+// later drain, so the output stays ordered by timestamp across drains, not only within one.
+// ERROR and above are written synchronously, together with everything staged before them.
+class LogBatcher {
+   public:
+    LogBatcher(std::shared_ptr<spdlog::logger> logger, std::size_t batchSize, std::chrono::milliseconds flushInterval);
+    ~LogBatcher();
+
+    LogBatcher(const LogBatcher&) = delete;
+    LogBatcher& operator=(const LogBatcher&) = delete;
+
+    void stage(spdlog::level::level_enum level, std::string_view message);
+
+    // Writes everything staged so far and flushes the sinks
+    void flush();
+
+    // flush() of every live batcher, for the exit path and the logger's signal watcher thread. Takes locks and
+    // allocates, so never call it from a signal handler.
+    static void flushAll();
+
+    // Pending records still go to the old sinks
+    void updateSinks(const std::function<void(std::vector<spdlog::sink_ptr>&)>& update);
+
+   private:
+    struct Record {
+        spdlog::log_clock::time_point time;
+        spdlog::level::level_enum level = spdlog::level::info;
+        std::size_t threadId = 0;
+        std::string payload;
+    };
+
+    struct ThreadBuffer {
+        explicit ThreadBuffer(std::size_t capacity) : records(capacity) {}
+
+        static constexpr spdlog::log_clock::rep idle = std::numeric_limits<spdlog::log_clock::rep>::max();
+
+        Concurrency::SPSCQueue<Record> records;
+        std::size_t threadId = spdlog::details::os::thread_id();
+        // Producer side only
+        std::size_t staged = 0;
+        // Producer side only: timestamp of the previous record, a lower bound of the next one
+        spdlog::log_clock::rep lastStamp = 0;
+        // Lower bound of the timestamp of the record being staged, idle otherwise
+        std::atomic<spdlog::log_clock::rep> stagingSince{idle};
+        // Writer side only: popped records held back by the watermark
+        std::vector<Record> pending;
+        // Set once the owning thread has exited, the writer drops the buffer after draining it
+        std::atomic<bool> orphaned{false};
+        // Set once the batcher is destroyed, the thread drops the buffer on its next new buffer
+        std::atomic<bool> closed{false};
+    };
+
+    ThreadBuffer& threadBuffer();
+    void wakeWriter();
+    void run(std::stop_token token);
+    // Callers hold m_writeMutex. With force, writes every popped record regardless of the watermark.
+    void drain(bool force);
+    void write(const Record& record);
+
+   private:
+    const std::uint64_t m_id;
+    const std::shared_ptr<spdlog::logger> m_logger;
+    const std::size_t m_batchSize;
+    const std::chrono::milliseconds m_flushInterval;
+
+    std::mutex m_buffersMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+
+    std::mutex m_writeMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_draining;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable_any m_wake;
+    // Producers only take m_wakeMutex when they are the first to request a drain since the writer woke up
+    std::atomic<bool> m_wakeRequested{false};
+
+    std::jthread m_writer;
+};
+
+}  // namespace Utils::Logging
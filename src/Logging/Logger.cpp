@@ -4,10 +4,27 @@
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
 #include <csignal>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#include "LogBatcher.h"
 
 namespace Utils::Logging {
 
+namespace {
+
+// Written by the signal handler, read by the signal watcher thread
+int s_signalPipe[2] = {-1, -1};
+
+}  // namespace
+
 constexpr spdlog::level::level_enum logLevelToSpdlogImpl(LogLevel level) {
     switch (level) {
         case LogLevel::DEBUG:
@@ -32,10 +49,16 @@ consteval spdlog::level::level_enum logLevelToSpdlog(LogLevel level) { return lo
 Logger::Logger(std::string name, std::shared_ptr<LoggerConfig> config)
     : m_name(std::move(name)),
       m_config(config ? config : std::make_shared<LoggerConfig>()),
-      m_logger(buildLogger(m_name, m_config)) {
+      m_logger(buildLogger(m_name, m_config)),
+      m_batcher(m_config->batching ? std::make_unique<LogBatcher>(
+                                         m_logger, m_config->batchSize,
+                                         std::chrono::milliseconds(m_config->batchFlushIntervalMs))
+                                   : nullptr) {
     updateLoggerLevel();
 }
 
+Logger::~Logger() = default;
+
 Logger& Logger::getInstance() {
     static Logger instance("Root");
     return instance;
@@ -51,18 +74,38 @@ void Logger::onUpdate(const std::shared_ptr<LoggerConfig>& newConfig) {
 
 template <LogLevel Level>
 void Logger::log(std::string_view message) {
+    if (m_batcher) {
+        if (m_logger->should_log(logLevelToSpdlog(Level))) m_batcher->stage(logLevelToSpdlog(Level), message);
+        return;
+    }
     m_logger->log(logLevelToSpdlog(Level), message);
 }
 
-void Logger::flush() { m_logger->flush(); }
+void Logger::flush() {
+    if (m_batcher) {
+        m_batcher->flush();
+        return;
+    }
+    m_logger->flush();
+}
 
 void Logger::addSink(std::shared_ptr<spdlog::sinks::sink> sink) {
     if (!sink) return;
-    m_logger->sinks().push_back(sink);
     sink->set_level(spdlog::level::trace);
+    if (m_batcher) {
+        m_batcher->updateSinks([&](std::vector<spdlog::sink_ptr>& sinks) { sinks.push_back(std::move(sink)); });
+        return;
+    }
+    m_logger->sinks().push_back(sink);
 }
 
-void Logger::clearSinks() { m_logger->sinks().clear(); }
+void Logger::clearSinks() {
+    if (m_batcher) {
+        m_batcher->updateSinks([](std::vector<spdlog::sink_ptr>& sinks) { sinks.clear(); });
+        return;
+    }
+    m_logger->sinks().clear();
+}
 
 void Logger::updateLoggerLevel() {
     LogLevel threshold = m_config->globalLogLevel;
@@ -78,12 +121,36 @@ std::shared_ptr<spdlog::logger> Logger::buildLogger(const std::string& name,
                                                     const std::shared_ptr<LoggerConfig>& config) {
     struct LifecycleManager {
         LifecycleManager() {
-            std::atexit([]() { spdlog::shutdown(); });
-
-            auto handler = [](int sig) {
+            // Batched records are still staged in memory, write them out before the sinks are shut down
+            std::atexit([]() {
+                LogBatcher::flushAll();
+                spdlog::shutdown();
+            });
+
+            // Flushing takes locks and allocates, which a signal handler must not do: the handler only passes the
+            // signal through a pipe, a watcher thread flushes and then raises it again with its default action
+            if (::pipe2(s_signalPipe, O_CLOEXEC) != 0) {
+                std::cerr << "Error creating logger signal pipe: " << std::strerror(errno) << std::endl;
+                return;
+            }
+            std::thread([] {
+                int sig = 0;
+                ssize_t bytesRead = 0;
+                do {
+                    bytesRead = ::read(s_signalPipe[0], &sig, sizeof(sig));
+                } while (bytesRead < 0 && errno == EINTR);
+                if (bytesRead != sizeof(sig)) return;
+
+                LogBatcher::flushAll();
                 spdlog::shutdown();
                 std::signal(sig, SIG_DFL);
                 std::raise(sig);
+            }).detach();
+
+            auto handler = [](int sig) {
+                const int savedErrno = errno;
+                [[maybe_unused]] const auto written = ::write(s_signalPipe[1], &sig, sizeof(sig));
+                errno = savedErrno;
             };
 
             std::signal(SIGINT, handler);
@@ -16,9 +16,12 @@ class sink;
 
 namespace Utils::Logging {
 
+class LogBatcher;
+
 class Logger {
    public:
     explicit Logger(std::string name, std::shared_ptr<LoggerConfig> config = nullptr);
+    ~Logger();
 
     static Logger& getInstance();
 
@@ -47,6 +50,8 @@ class Logger {
     std::shared_ptr<LoggerConfig> m_config = std::make_shared<LoggerConfig>();
 
     const std::shared_ptr<spdlog::logger> m_logger;
+    // Only set when LoggerConfig::batching was on at construction
+    const std::unique_ptr<LogBatcher> m_batcher;
 };
 
 }  // namespace Utils::Logging
\ No newline at end of file
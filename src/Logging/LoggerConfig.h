@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 
@@ -15,6 +17,13 @@ struct LoggerConfig {
     std::string filename = "mainLog.txt";
     LogLevel globalLogLevel = LogLevel::INFO;
     std::unordered_map<std::string, LogLevel> loggersLogLevels;
+
+    // Read once when a Logger is constructed. With batching, every thread stages its records in its own buffer of
+    // batchSize entries and a background writer moves them to the sinks when a buffer is half full, at least every
+    // batchFlushIntervalMs and on Logger::flush().
+    bool batching = false;
+    std::size_t batchSize = 1024;
+    std::uint32_t batchFlushIntervalMs = 50;
 };
 
 }  // namespace Utils::Logging
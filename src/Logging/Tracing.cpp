@@ -0,0 +1,392 @@
+#include "Tracing.h"
+
+#include <spdlog/fmt/fmt.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <stop_token>
+#include <thread>
+
+#include "Logger.h"
+
+namespace Utils::Logging {
+
+namespace {
+
+struct SpanSite {
+    std::string name;
+    const char* file;
+    int line;
+};
+
+struct MergedHistogram {
+    uint64_t count = 0;
+    uint64_t totalTicks = 0;
+    uint64_t maxTicks = 0;
+    std::array<uint64_t, SpanHistogram::bucketCount> buckets{};
+};
+
+struct RetiredEvent {
+    uint64_t threadId;
+    TraceEvent event;
+};
+
+// Trace events of exited threads are kept up to this many threads' worth of buffers in total
+constexpr std::size_t retiredEventBuffers = 16;
+
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector<SpanSite> spans;
+    std::vector<std::unique_ptr<ThreadTraceState>> threads;
+    std::vector<ThreadTraceState*> freeThreads;
+    // Shared by spans that finish on a thread after it was retired (in thread_local destructors), never recycled.
+    // Several exiting threads may record at once, so it is only written and read under the mutex.
+    ThreadTraceState* lateThread = nullptr;
+    uint64_t lastThreadId = 0;
+    std::vector<MergedHistogram> reported;
+    std::vector<MergedHistogram> retired;
+    std::vector<RetiredEvent> retiredEvents;
+    std::size_t eventsPerThread = 0;
+
+    const uint64_t epochTicks = TraceClock::now();
+};
+
+// Never destroyed: threads may still finish spans while static objects are being torn down
+TraceRegistry& registry() {
+    static auto* s_registry = new TraceRegistry();
+    return *s_registry;
+}
+
+// The last id collects the spans of every site registered past the limit
+constexpr uint32_t overflowSpanId = ThreadTraceState::maxSpans - 1;
+
+void accumulate(MergedHistogram& merged, const SpanHistogram& histogram) {
+    merged.count += histogram.count.load(std::memory_order_relaxed);
+    merged.totalTicks += histogram.totalTicks.load(std::memory_order_relaxed);
+    merged.maxTicks = std::max(merged.maxTicks, histogram.maxTicks.load(std::memory_order_relaxed));
+    for (std::size_t bucket = 0; bucket < SpanHistogram::bucketCount; ++bucket) {
+        merged.buckets[bucket] += histogram.buckets[bucket].load(std::memory_order_relaxed);
+    }
+}
+
+MergedHistogram mergeSpan(const TraceRegistry& traceRegistry, uint32_t spanId) {
+    MergedHistogram merged = traceRegistry.retired[spanId];
+    for (const auto& state : traceRegistry.threads) {
+        const auto* histogram = state->histograms[spanId].load(std::memory_order_acquire);
+        if (histogram != nullptr) accumulate(merged, *histogram);
+    }
+    return merged;
+}
+
+double bucketPercentileTicks(const MergedHistogram& histogram, double fraction) {
+    const auto target = static_cast<uint64_t>(fraction * static_cast<double>(histogram.count));
+    uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < SpanHistogram::bucketCount; ++bucket) {
+        seen += histogram.buckets[bucket];
+        if (seen > target) return std::ldexp(1.0, static_cast<int>(bucket));
+    }
+    return static_cast<double>(histogram.maxTicks);
+}
+
+std::string escapeJson(std::string_view text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char c : text) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += static_cast<unsigned char>(c) < 0x20 ? ' ' : c;
+    }
+    return escaped;
+}
+
+struct Reporter {
+    std::mutex mutex;
+    std::condition_variable_any wakeUp;
+    std::jthread thread;
+};
+
+Reporter s_reporter;
+
+double calibrateNanosecondsPerTick() {
+#ifdef UTILS_TRACING_HAS_TSC
+    // The TSC is invariant on every CPU this targets, a short window against steady_clock is precise to ~0.1%
+    const auto startTime = std::chrono::steady_clock::now();
+    const auto startTicks = TraceClock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    const auto elapsed = std::chrono::steady_clock::now() - startTime;
+    const auto ticks = TraceClock::now() - startTicks;
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+           static_cast<double>(ticks);
+#else
+    using Period = std::chrono::steady_clock::period;
+    return 1e9 * static_cast<double>(Period::num) / static_cast<double>(Period::den);
+#endif
+}
+
+// Set once the thread's state was retired, spans finishing after that go to the shared late state
+constinit thread_local bool t_threadExited = false;
+
+}  // namespace
+
+std::atomic<bool> Tracer::s_traceEventsEnabled{false};
+constinit thread_local ThreadTraceState* Tracer::t_state = nullptr;
+
+// Destroyed with the thread's other thread_locals, hands its state back to the registry
+struct Tracer::ThreadExit {
+    ~ThreadExit() {
+        if (t_state != nullptr) retireThread(t_state);
+        t_state = nullptr;
+        t_threadExited = true;
+    }
+};
+
+double TraceClock::nanosecondsPerTick() {
+    static std::once_flag s_calibrated;
+    static double s_nanosecondsPerTick = 0.0;
+    std::call_once(s_calibrated, [] { s_nanosecondsPerTick = calibrateNanosecondsPerTick(); });
+    return s_nanosecondsPerTick;
+}
+
+ThreadTraceState::ThreadTraceState() = default;
+
+ThreadTraceState::~ThreadTraceState() {
+    for (auto& histogram : histograms) {
+        delete histogram.load(std::memory_order_relaxed);
+    }
+}
+
+SpanHistogram& ThreadTraceState::allocateHistogram(uint32_t spanId) {
+    auto* histogram = new SpanHistogram();
+    histograms[spanId].store(histogram, std::memory_order_release);
+    return *histogram;
+}
+
+void ThreadTraceState::reset() {
+    for (auto& slot : histograms) {
+        auto* histogram = slot.load(std::memory_order_relaxed);
+        if (histogram == nullptr) continue;
+
+        histogram->count.store(0, std::memory_order_relaxed);
+        histogram->totalTicks.store(0, std::memory_order_relaxed);
+        histogram->maxTicks.store(0, std::memory_order_relaxed);
+        for (auto& bucket : histogram->buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+    eventCount.store(0, std::memory_order_relaxed);
+    droppedEvents.store(0, std::memory_order_relaxed);
+}
+
+uint32_t Tracer::registerSpan(const char* name, const char* file, int line) {
+    auto& traceRegistry = registry();
+    std::lock_guard lock(traceRegistry.mutex);
+    if (traceRegistry.spans.size() >= overflowSpanId) {
+        return overflowSpanId;
+    }
+    traceRegistry.spans.push_back({name, file, line});
+    const auto trackedSpans =
+        traceRegistry.spans.size() < overflowSpanId ? traceRegistry.spans.size() : overflowSpanId + 1;
+    traceRegistry.reported.resize(trackedSpans);
+    traceRegistry.retired.resize(trackedSpans);
+    return static_cast<uint32_t>(traceRegistry.spans.size() - 1);
+}
+
+void Tracer::recordUnregistered(uint32_t spanId, uint64_t startTicks, uint64_t endTicks) {
+    if (!t_threadExited) {
+        t_state = registerThread();
+        record(spanId, startTicks, endTicks);
+        return;
+    }
+
+    // Without trace event buffer, the events of exited threads are already in retiredEvents
+    auto& traceRegistry = registry();
+    std::lock_guard lock(traceRegistry.mutex);
+    if (traceRegistry.lateThread == nullptr) {
+        traceRegistry.threads.push_back(std::make_unique<ThreadTraceState>());
+        traceRegistry.lateThread = traceRegistry.threads.back().get();
+        traceRegistry.lateThread->threadId = 0;
+    }
+    traceRegistry.lateThread->histogram(spanId).record(endTicks - startTicks);
+}
+
+ThreadTraceState* Tracer::registerThread() {
+    auto& traceRegistry = registry();
+    ThreadTraceState* state = nullptr;
+    {
+        std::lock_guard lock(traceRegistry.mutex);
+        if (!traceRegistry.freeThreads.empty()) {
+            state = traceRegistry.freeThreads.back();
+            traceRegistry.freeThreads.pop_back();
+        } else {
+            traceRegistry.threads.push_back(std::make_unique<ThreadTraceState>());
+            state = traceRegistry.threads.back().get();
+            state->events.resize(traceRegistry.eventsPerThread);
+        }
+        state->threadId = ++traceRegistry.lastThreadId;
+    }
+
+    static thread_local ThreadExit s_threadExit;
+    return state;
+}
+
+void Tracer::retireThread(ThreadTraceState* state) {
+    auto& traceRegistry = registry();
+    std::lock_guard lock(traceRegistry.mutex);
+
+    // The thread's spans keep showing up in summaries and trace files after its state is reused
+    for (uint32_t spanId = 0; spanId < traceRegistry.retired.size(); ++spanId) {
+        if (const auto* histogram = state->histograms[spanId].load(std::memory_order_relaxed)) {
+            accumulate(traceRegistry.retired[spanId], *histogram);
+        }
+    }
+    const auto eventCount = state->eventCount.load(std::memory_order_relaxed);
+    const auto retainedEvents = traceRegistry.eventsPerThread * retiredEventBuffers;
+    for (std::size_t i = 0; i < eventCount && traceRegistry.retiredEvents.size() < retainedEvents; ++i) {
+        traceRegistry.retiredEvents.push_back({state->threadId, state->events[i]});
+    }
+
+    state->reset();
+    traceRegistry.freeThreads.push_back(state);
+}
+
+std::vector<SpanSummary> Tracer::collect() {
+    const double nsPerTick = TraceClock::nanosecondsPerTick();
+    auto& traceRegistry = registry();
+    std::lock_guard lock(traceRegistry.mutex);
+
+    std::vector<uint32_t> spanIds(traceRegistry.spans.size());
+    std::iota(spanIds.begin(), spanIds.end(), 0);
+    if (traceRegistry.spans.size() >= overflowSpanId) {
+        spanIds.push_back(overflowSpanId);
+    }
+
+    std::vector<SpanSummary> summaries;
+    for (const auto spanId : spanIds) {
+        const auto current = mergeSpan(traceRegistry, spanId);
+        auto& previous = traceRegistry.reported[spanId];
+
+        // Histograms only grow, the difference to the last collect() is what happened in between
+        MergedHistogram delta;
+        delta.count = current.count - previous.count;
+        delta.totalTicks = current.totalTicks - previous.totalTicks;
+        delta.maxTicks = current.maxTicks;
+        for (std::size_t bucket = 0; bucket < SpanHistogram::bucketCount; ++bucket) {
+            delta.buckets[bucket] = current.buckets[bucket] - previous.buckets[bucket];
+        }
+        previous = current;
+        if (delta.count == 0) continue;
+
+        SpanSummary summary;
+        summary.name = spanId == overflowSpanId ? "<other spans>" : traceRegistry.spans[spanId].name;
+        summary.count = delta.count;
+        summary.totalNs = static_cast<double>(delta.totalTicks) * nsPerTick;
+        summary.meanNs = summary.totalNs / static_cast<double>(delta.count);
+        summary.p50Ns = bucketPercentileTicks(delta, 0.50) * nsPerTick;
+        summary.p99Ns = bucketPercentileTicks(delta, 0.99) * nsPerTick;
+        summary.maxNs = static_cast<double>(delta.maxTicks) * nsPerTick;
+        summaries.push_back(std::move(summary));
+    }
+    return summaries;
+}
+
+void Tracer::report(Logger& logger) {
+    for (const auto& summary : collect()) {
+        logger.log<LogLevel::INFO>(fmt::format(
+            "[trace] {}: count={} mean={:.1f}ns p50<={:.0f}ns p99<={:.0f}ns max={:.0f}ns total={:.3f}ms", summary.name,
+            summary.count, summary.meanNs, summary.p50Ns, summary.p99Ns, summary.maxNs, summary.totalNs / 1e6));
+    }
+}
+
+void Tracer::startReporting(Logger& logger, std::chrono::milliseconds interval) {
+    stopReporting();
+
+    // Registered after a logger was built and so after its atexit spdlog::shutdown(): runs first and joins the
+    // reporter while logging still works, rather than when s_reporter is destroyed among the other statics
+    static const bool s_stopAtExit = [] { return std::atexit([] { stopReporting(); }) == 0; }();
+    static_cast<void>(s_stopAtExit);
+
+    s_reporter.thread = std::jthread([&logger, interval](std::stop_token stopToken) {
+        while (!stopToken.stop_requested()) {
+            {
+                std::unique_lock lock(s_reporter.mutex);
+                s_reporter.wakeUp.wait_for(lock, stopToken, interval, [] { return false; });
+            }
+            if (stopToken.stop_requested()) break;
+            report(logger);
+        }
+    });
+}
+
+void Tracer::stopReporting() {
+    if (s_reporter.thread.joinable()) {
+        s_reporter.thread.request_stop();
+        s_reporter.thread.join();
+    }
+}
+
+void Tracer::enableTraceEvents(std::size_t eventsPerThread) {
+    auto& traceRegistry = registry();
+    {
+        std::lock_guard lock(traceRegistry.mutex);
+        // Buffers are sized once: owners write them without locks, so they are never reallocated afterwards
+        if (traceRegistry.eventsPerThread == 0) {
+            traceRegistry.eventsPerThread = eventsPerThread;
+            for (auto& state : traceRegistry.threads) {
+                if (state.get() != traceRegistry.lateThread) state->events.resize(eventsPerThread);
+            }
+        }
+    }
+    s_traceEventsEnabled.store(true, std::memory_order_release);
+}
+
+void Tracer::disableTraceEvents() { s_traceEventsEnabled.store(false, std::memory_order_release); }
+
+bool Tracer::writeChromeTrace(const std::filesystem::path& path) {
+    const double nsPerTick = TraceClock::nanosecondsPerTick();
+    auto& traceRegistry = registry();
+    std::lock_guard lock(traceRegistry.mutex);
+
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) return false;
+
+    const auto pid = ::getpid();
+    const auto toMicroseconds = [&](uint64_t ticks) { return static_cast<double>(ticks) * nsPerTick / 1000.0; };
+
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    const auto writeEvent = [&](const TraceEvent& event, uint64_t threadId) {
+        const auto& name =
+            event.spanId < traceRegistry.spans.size() ? traceRegistry.spans[event.spanId].name : "<other spans>";
+
+        out << (first ? "" : ",")
+            << fmt::format(R"({{"name":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":{},"tid":{}}})",
+                           escapeJson(name), toMicroseconds(event.startTicks - traceRegistry.epochTicks),
+                           toMicroseconds(event.endTicks - event.startTicks), pid, threadId);
+        first = false;
+    };
+    for (const auto& retired : traceRegistry.retiredEvents) {
+        writeEvent(retired.event, retired.threadId);
+    }
+    for (const auto& state : traceRegistry.threads) {
+        const auto eventCount = state->eventCount.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < eventCount; ++i) {
+            writeEvent(state->events[i], state->threadId);
+        }
+    }
+    out << "],\"displayTimeUnit\":\"ns\"}\n";
+    return static_cast<bool>(out);
+}
+
+std::size_t Tracer::threadStateCount() {
+    auto& traceRegistry = registry();
+    std::lock_guard lock(traceRegistry.mutex);
+    return traceRegistry.threads.size();
+}
+
+}  // namespace Utils::Logging
@@ -0,0 +1,180 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define UTILS_TRACING_HAS_TSC 1
+#endif
+
+namespace Utils::Logging {
+
+class Logger;
+
+// Tick source of the spans: the TSC where available (a few ns per read), the monotonic clock elsewhere.
+// Ticks are converted to nanoseconds only when summaries or trace files are produced.
+struct TraceClock {
+    static uint64_t now() {
+#ifdef UTILS_TRACING_HAS_TSC
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    // Calibrated against steady_clock on first use (a few ms), which is the first summary or trace file
+    static double nanosecondsPerTick();
+};
+
+// Per-thread, per-span histogram. Only the owning thread writes it, so updates are plain relaxed load/store pairs
+// without read-modify-write; the aggregator reads it concurrently with relaxed loads.
+struct SpanHistogram {
+    static constexpr std::size_t bucketCount = 65;  // bucket b holds durations in [2^(b-1), 2^b) ticks
+
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> totalTicks{0};
+    std::atomic<uint64_t> maxTicks{0};
+    std::array<std::atomic<uint64_t>, bucketCount> buckets{};
+
+    void record(uint64_t ticks) {
+        bump(count, 1);
+        bump(totalTicks, ticks);
+        if (ticks > maxTicks.load(std::memory_order_relaxed)) maxTicks.store(ticks, std::memory_order_relaxed);
+        bump(buckets[std::bit_width(ticks)], 1);
+    }
+
+   private:
+    static void bump(std::atomic<uint64_t>& value, uint64_t delta) {
+        value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+};
+
+struct TraceEvent {
+    uint32_t spanId;
+    uint64_t startTicks;
+    uint64_t endTicks;
+};
+
+// Spans recorded by one thread: lazily allocated histograms plus an optional bounded buffer of trace events.
+// When the thread exits its data is merged into the Tracer's retired totals and the state is reused by a later thread.
+struct ThreadTraceState {
+    static constexpr std::size_t maxSpans = 1024;
+
+    ThreadTraceState();
+    ~ThreadTraceState();
+
+    SpanHistogram& histogram(uint32_t spanId) {
+        auto* histogram = histograms[spanId].load(std::memory_order_acquire);
+        return histogram ? *histogram : allocateHistogram(spanId);
+    }
+
+    SpanHistogram& allocateHistogram(uint32_t spanId);
+
+    // Zeroes histograms and events, keeping their allocations for the next owner
+    void reset();
+
+    void addEvent(uint32_t spanId, uint64_t startTicks, uint64_t endTicks) {
+        const auto size = eventCount.load(std::memory_order_relaxed);
+        if (size >= events.size()) {
+            droppedEvents.store(droppedEvents.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+        events[size] = {spanId, startTicks, endTicks};
+        eventCount.store(size + 1, std::memory_order_release);
+    }
+
+    uint64_t threadId;
+    std::array<std::atomic<SpanHistogram*>, maxSpans> histograms{};
+    std::vector<TraceEvent> events;
+    std::atomic<std::size_t> eventCount{0};
+    std::atomic<uint64_t> droppedEvents{0};
+};
+
+struct SpanSummary {
+    std::string name;
+    uint64_t count = 0;
+    double totalNs = 0.0;
+    double meanNs = 0.0;
+    double p50Ns = 0.0;  // upper bound of the log2 bucket holding the percentile
+    double p99Ns = 0.0;
+    double maxNs = 0.0;  // since the first span, not since the previous collect()
+};
+
+// Registry of span sites and per-thread span data. Recording is lock-free and costs a couple of TSC reads and a
+// handful of thread-local stores; aggregation and export walk all threads under a mutex off the hot path.
+class Tracer {
+   public:
+    // Called once per TRACE_SCOPE site (function-local static), returns the id used for recording
+    static uint32_t registerSpan(const char* name, const char* file, int line);
+
+    static void record(uint32_t spanId, uint64_t startTicks, uint64_t endTicks) {
+        if (t_state == nullptr) [[unlikely]] {
+            recordUnregistered(spanId, startTicks, endTicks);
+            return;
+        }
+        t_state->histogram(spanId).record(endTicks - startTicks);
+        if (s_traceEventsEnabled.load(std::memory_order_acquire)) {
+            t_state->addEvent(spanId, startTicks, endTicks);
+        }
+    }
+
+    // Summaries of everything recorded since the previous collect(), across all threads
+    static std::vector<SpanSummary> collect();
+
+    // Logs the collect() summaries through the logger, one line per span
+    static void report(Logger& logger);
+
+    // Background thread reporting to the logger every interval; the logger must outlive stopReporting()
+    static void startReporting(Logger& logger, std::chrono::milliseconds interval);
+    static void stopReporting();
+
+    // Keeps up to eventsPerThread spans per thread for writeChromeTrace(), later spans are dropped
+    static void enableTraceEvents(std::size_t eventsPerThread = 1 << 16);
+    static void disableTraceEvents();
+
+    // Writes recorded events in Chrome's trace event format (chrome://tracing, Perfetto)
+    static bool writeChromeTrace(const std::filesystem::path& path);
+
+    // Per-thread states allocated so far, bounded by the peak number of threads tracing at once
+    static std::size_t threadStateCount();
+
+   private:
+    struct ThreadExit;
+
+    // First span of a thread, or a span finishing after the thread's state was retired
+    static void recordUnregistered(uint32_t spanId, uint64_t startTicks, uint64_t endTicks);
+    static ThreadTraceState* registerThread();
+    static void retireThread(ThreadTraceState* state);
+
+    static constinit thread_local ThreadTraceState* t_state;
+
+    static std::atomic<bool> s_traceEventsEnabled;
+};
+
+// Times the enclosing scope into the span's histogram
+class ScopedTimer {
+   public:
+    explicit ScopedTimer(uint32_t spanId) : m_spanId(spanId), m_start(TraceClock::now()) {}
+    ~ScopedTimer() { Tracer::record(m_spanId, m_start, TraceClock::now()); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+   private:
+    uint32_t m_spanId;
+    uint64_t m_start;
+};
+
+}  // namespace Utils::Logging
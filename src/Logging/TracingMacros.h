@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Tracing.h"
+
+// Build with UTILS_TRACING_DISABLED (CMake: -DUTILS_ENABLE_TRACING=OFF) to compile every span out
+#ifndef UTILS_TRACING_DISABLED
+
+#define UTILS_TRACE_CONCAT_IMPL(a, b) a##b
+#define UTILS_TRACE_CONCAT(a, b) UTILS_TRACE_CONCAT_IMPL(a, b)
+
+#define UTILS_TRACE_SCOPE_IMPL(name, id)                                                                              \
+    static const uint32_t UTILS_TRACE_CONCAT(_utilsTraceSpan, id) =                                                   \
+        Utils::Logging::Tracer::registerSpan(name, __FILE__, __LINE__);                                               \
+    const Utils::Logging::ScopedTimer UTILS_TRACE_CONCAT(_utilsTraceTimer, id)(UTILS_TRACE_CONCAT(_utilsTraceSpan, id))
+
+#define TRACE_SCOPE(name) UTILS_TRACE_SCOPE_IMPL(name, __COUNTER__)
+#define TRACE_FUNCTION() TRACE_SCOPE(__func__)
+
+#else
+
+#define TRACE_SCOPE(name) static_cast<void>(0)
+#define TRACE_FUNCTION() static_cast<void>(0)
+
+#endif
@@ -7,8 +7,12 @@
 #include <cstddef>
 #include <memory>
 #include <shared_mutex>
+#include <unordered_map>
 #include <unordered_set>
 
+#include "Concurrency/Strand.h"
+#include "Concurrency/WorkStealingExecutor.h"
+
 namespace Utils::PublishSubscribe {
 
 template <typename Message>
@@ -63,6 +67,9 @@ class PublishSubscribeManager {
 
         std::lock_guard lock(s_mutex);
         m_subscribers.emplace(subscriber);
+        if (m_executor && m_preserveSubscriberOrder) {
+            m_strands.try_emplace(subscriber, std::make_shared<Concurrency::Strand>(*m_executor));
+        }
     }
 
     void removeSubscriber(ISubscriber<Message>* subscriber) {
@@ -70,13 +77,48 @@ class PublishSubscribeManager {
 
         std::lock_guard lock(s_mutex);
         m_subscribers.erase(subscriber);
+        m_strands.erase(subscriber);
+    }
+
+    // Delivers to the subscribers in parallel on the executor. publishMessage() still returns only once every
+    // subscriber got the message, runs queued callbacks itself while waiting and rethrows the first exception an
+    // onUpdate() threw. With preserveSubscriberOrder the calls of one subscriber never run on two threads at once and
+    // keep the order of the publishMessage() calls. They may nest, as without an executor: a subscriber that publishes
+    // from onUpdate() gets that message, and messages queued for it meanwhile, inside the running onUpdate() on the
+    // same thread. Subscribers may publish from onUpdate() in both modes. nullptr restores delivery on the publishing
+    // thread.
+    void setExecutor(std::shared_ptr<Concurrency::WorkStealingExecutor> executor, bool preserveSubscriberOrder = true) {
+        std::lock_guard lock(s_mutex);
+        m_strands.clear();
+        m_executor = std::move(executor);
+        m_preserveSubscriberOrder = preserveSubscriberOrder;
+        if (m_executor && m_preserveSubscriberOrder) {
+            for (auto* subscriber : m_subscribers) {
+                m_strands.emplace(subscriber, std::make_shared<Concurrency::Strand>(*m_executor));
+            }
+        }
     }
 
     void publishMessage(const Message& message) {
         std::shared_lock lock(s_mutex);
+        if (!m_executor) {
+            for (auto* subscriber : m_subscribers) {
+                subscriber->onUpdate(message);
+            }
+            return;
+        }
+
+        // The message and the subscribers stay alive until wait() returns
+        Concurrency::TaskGroup group;
         for (auto* subscriber : m_subscribers) {
-            subscriber->onUpdate(message);
+            auto deliver = [subscriber, &message] { subscriber->onUpdate(message); };
+            if (m_preserveSubscriberOrder) {
+                m_strands.at(subscriber)->post(group, std::move(deliver));
+            } else {
+                m_executor->submit(group, std::move(deliver));
+            }
         }
+        m_executor->wait(group);
     }
 
     size_t getPublisherCount() const {
@@ -109,6 +151,11 @@ class PublishSubscribeManager {
 
     std::unordered_set<IPublisher<Message>*> m_publishers;
     std::unordered_set<ISubscriber<Message>*> m_subscribers;
+
+    std::shared_ptr<Concurrency::WorkStealingExecutor> m_executor;
+    bool m_preserveSubscriberOrder = true;
+    // Shared with the strands' queued turns, so removing a subscriber never frees a strand that is still draining
+    std::unordered_map<ISubscriber<Message>*, std::shared_ptr<Concurrency::Strand>> m_strands;
 };
 
 // Static member definitions
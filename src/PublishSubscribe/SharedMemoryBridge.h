@@ -0,0 +1,270 @@
+//
+// Created by Jakub Szwedowicz on 10/19/26.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Concurrency/CacheLine.h"
+#include "Concurrency/SharedMemoryChannel.h"
+#include "IPublisherSubscriber.h"
+#include "glaze/glaze.hpp"
+
+namespace Utils::PublishSubscribe {
+
+namespace detail {
+
+// Messages the inbound side of the bridges is publishing right now. Tracked by address rather than with a
+// thread_local flag, because with an executor onUpdate() runs on other threads than the publishing one.
+template <typename Message>
+class InboundMessages {
+   public:
+    static constexpr std::size_t capacity = 64;
+
+    // capacity when every place is taken
+    static std::size_t acquire() {
+        for (std::size_t i = 0; i < capacity; ++i) {
+            bool free = false;
+            if (s_taken[i].compare_exchange_strong(free, true)) {
+                auto used = s_used.load();
+                while (used < i + 1 && !s_used.compare_exchange_weak(used, i + 1)) {
+                }
+                return i;
+            }
+        }
+        return capacity;
+    }
+
+    static void release(std::size_t index) {
+        if (index < capacity) s_taken[index].store(false);
+    }
+
+    static void set(std::size_t index, const Message* message) {
+        if (index < capacity) s_messages[index].store(message, std::memory_order_release);
+    }
+
+    static bool contains(const Message* message) {
+        const auto used = s_used.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < used; ++i) {
+            if (s_messages[i].load(std::memory_order_acquire) == message) return true;
+        }
+        return false;
+    }
+
+   private:
+    inline static std::array<std::atomic<const Message*>, capacity> s_messages{};
+    inline static std::array<std::atomic<bool>, capacity> s_taken{};
+    inline static std::atomic<std::size_t> s_used{0};
+};
+
+// Inbound messages being delivered straight from their slot in this process. The slot stays taken until the local
+// publish returns, so a subscriber forwarding to a full ring from onUpdate() would wait on its own delivery. Such
+// writes are queued instead and written, in order, by the last delivery to give its slot back. Shared by all message
+// types, any of them may go out through the channel a delivery is holding.
+class InPlaceDeliveries {
+   public:
+    static void begin() {
+        std::lock_guard lock(s_mutex);
+        ++s_active;
+    }
+
+    // Called once the delivery's slot is released
+    static void end() {
+        std::unique_lock lock(s_mutex);
+        --s_active;
+        if (s_writing) return;
+
+        // Whoever writes the queue writes everything queued meanwhile as well, so the order holds
+        s_writing = true;
+        while (!s_queued.empty()) {
+            auto queued = std::exchange(s_queued, {});
+            lock.unlock();
+            for (const auto& [channel, bytes] : queued) channel->write(std::as_bytes(std::span(bytes)));
+            lock.lock();
+        }
+        s_writing = false;
+    }
+
+    // Writes without blocking or queues behind earlier queued writes, false when no delivery is in place
+    static bool writeOrQueue(const std::shared_ptr<Concurrency::SharedMemoryChannel>& channel,
+                             std::span<const std::byte> bytes) {
+        std::lock_guard lock(s_mutex);
+        if (s_active == 0 && !s_writing && s_queued.empty()) return false;
+        if (!s_writing && s_queued.empty() && channel->tryWrite(bytes)) return true;
+
+        s_queued.emplace_back(channel, std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size()));
+        return true;
+    }
+
+   private:
+    inline static std::mutex s_mutex;
+    inline static std::size_t s_active = 0;
+    inline static bool s_writing = false;
+    inline static std::vector<std::pair<std::shared_ptr<Concurrency::SharedMemoryChannel>, std::string>> s_queued;
+};
+
+}  // namespace detail
+
+// Connects this process' PublishSubscribeManager<Message> to a shared memory channel. Messages published locally
+// are written to the channel, messages other processes wrote are published locally from a receiver thread. Messages
+// that arrived through a bridge are never sent back out.
+// Trivially copyable messages travel as raw bytes and are published straight from their slot, without a copy;
+// anything else is serialized with glaze's BEVE and decoded before it is published. Subscribers may publish through
+// a bridge from onUpdate(): while a delivery holds its slot, writes that find the ring full are queued instead of
+// blocking and go out right after the delivery.
+// A bridge that cannot connect (its message does not fit a slot, no reader place or more than
+// InboundMessages::capacity receiving bridges of one message type) reports the error and stays unsubscribed.
+template <typename Message>
+class SharedMemoryBridge : public ISubscriber<Message> {
+    static constexpr bool s_rawBytes = std::is_trivially_copyable_v<Message>;
+    static_assert(!s_rawBytes || alignof(Message) <= Concurrency::cacheLineSize,
+                  "Messages are read in place from slots aligned to a cache line");
+
+   public:
+    explicit SharedMemoryBridge(std::shared_ptr<Concurrency::SharedMemoryChannel> channel, bool forward = true,
+                                bool receive = true)
+        : m_channel(std::move(channel)), m_forward(forward) {
+        if constexpr (s_rawBytes) {
+            if (sizeof(Message) > m_channel->getSlotSize()) {
+                std::cerr << "Error bridging to shared memory channel " << m_channel->getName() << ": message of "
+                          << sizeof(Message) << " bytes does not fit its slots" << std::endl;
+                disconnect();
+                return;
+            }
+        }
+        if (receive) {
+            m_inboundSlot = detail::InboundMessages<Message>::acquire();
+            if (m_inboundSlot == detail::InboundMessages<Message>::capacity) {
+                std::cerr << "Error bridging to shared memory channel " << m_channel->getName() << ": more than "
+                          << detail::InboundMessages<Message>::capacity
+                          << " bridges receive this message type, echoes could no longer be told apart" << std::endl;
+                disconnect();
+                return;
+            }
+            // Subscribed here, not in the thread, so nothing written after construction is missed
+            m_reader = m_channel->subscribe();
+            if (!m_reader) {
+                disconnect();
+                return;
+            }
+            m_receiver = std::jthread([this](std::stop_token token) { run(std::move(token)); });
+        }
+        m_connected = true;
+    }
+
+    ~SharedMemoryBridge() override {
+        m_receiver.request_stop();
+        if (m_receiver.joinable()) m_receiver.join();
+        detail::InboundMessages<Message>::release(m_inboundSlot);
+    }
+
+    bool isConnected() const { return m_connected; }
+
+    void onUpdate(const Message& message) override {
+        if (!m_forward || detail::InboundMessages<Message>::contains(&message)) return;
+
+        if constexpr (s_rawBytes) {
+            send(std::as_bytes(std::span(&message, 1)));
+        } else {
+            thread_local std::string buffer;
+            buffer.clear();
+            if (auto ec = glz::write_beve(message, buffer)) {
+                std::cerr << "Error encoding message for shared memory channel " << m_channel->getName() << ": "
+                          << static_cast<uint32_t>(ec.ec) << std::endl;
+                return;
+            }
+            send(std::as_bytes(std::span(buffer)));
+        }
+    }
+
+   private:
+    // Not delivered to a bridge that failed to set itself up, which would only report the same error on every publish
+    void disconnect() { PublishSubscribeManager<Message>::getManager()->removeSubscriber(this); }
+
+    void send(std::span<const std::byte> bytes) {
+        if (bytes.size() > m_channel->getSlotSize()) {
+            std::cerr << "Error forwarding message to shared memory channel " << m_channel->getName() << ": "
+                      << bytes.size() << " bytes exceed the slot size of " << m_channel->getSlotSize() << std::endl;
+            return;
+        }
+        if (detail::InPlaceDeliveries::writeOrQueue(m_channel, bytes)) return;
+        m_channel->write(bytes);
+    }
+
+    void run(std::stop_token token) {
+        auto* manager = PublishSubscribeManager<Message>::getManager();
+        while (!token.stop_requested()) {
+            const auto received = m_reader->read(s_pollInterval);
+            if (!received || received->origin == m_channel->getOriginId()) continue;
+
+            if constexpr (s_rawBytes) {
+                if (received->payload.size() != sizeof(Message)) {
+                    std::cerr << "Error reading shared memory channel " << m_channel->getName() << ": expected "
+                              << sizeof(Message) << " bytes, got " << received->payload.size() << std::endl;
+                    continue;
+                }
+                // The writer copied a whole Message into the slot, which stays ours until release()
+                const auto* message = std::launder(reinterpret_cast<const Message*>(received->payload.data()));
+                detail::InPlaceDeliveries::begin();
+                deliver(*manager, *message);
+                m_reader->release();
+                detail::InPlaceDeliveries::end();
+            } else {
+                Message message{};
+                const std::string_view beve(reinterpret_cast<const char*>(received->payload.data()),
+                                            received->payload.size());
+                if (auto ec = glz::read_beve(message, beve)) {
+                    std::cerr << "Error decoding message from shared memory channel " << m_channel->getName() << ": "
+                              << static_cast<uint32_t>(ec.ec) << std::endl;
+                    continue;
+                }
+                // Decoded into our own copy, so the slot can go back before subscribers write to the channel
+                m_reader->release();
+                deliver(*manager, message);
+            }
+        }
+    }
+
+    void deliver(PublishSubscribeManager<Message>& manager, const Message& message) {
+        detail::InboundMessages<Message>::set(m_inboundSlot, &message);
+        // Nobody up the receiver thread could handle it, and the slot still has to go back
+        try {
+            manager.publishMessage(message);
+        } catch (const std::exception& e) {
+            std::cerr << "Error delivering message from shared memory channel " << m_channel->getName() << ": "
+                      << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "Error delivering message from shared memory channel " << m_channel->getName()
+                      << ": unknown exception" << std::endl;
+        }
+        detail::InboundMessages<Message>::set(m_inboundSlot, nullptr);
+    }
+
+   private:
+    static constexpr auto s_pollInterval = std::chrono::milliseconds(100);
+
+    const std::shared_ptr<Concurrency::SharedMemoryChannel> m_channel;
+    const bool m_forward;
+    std::size_t m_inboundSlot = detail::InboundMessages<Message>::capacity;
+    bool m_connected = false;
+    std::unique_ptr<Concurrency::SharedMemoryChannel::Reader> m_reader;
+    std::jthread m_receiver;
+};
+
+}  // namespace Utils::PublishSubscribe
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "Config/ConfigManagers.h"
+#include "Config/ConfigParser/BeveConfigParser.h"
+#include "Config/ConfigParser/CachedConfigParser.h"
+#include "Config/ConfigParser/ConfigSnapshot.h"
+#include "Config/ConfigParser/MappedFile.h"
+#include "Mocks.h"
+
+class testBeveConfigParser : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        testConfig = *createTestConfig("beve_test", 321, 0.5, true);
+        jsonPath = std::filesystem::temp_directory_path() / "testBeveConfigParser.json";
+        writeJson(testConfig);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(jsonPath);
+        std::filesystem::remove(Utils::Config::snapshotPathFor(jsonPath));
+    }
+
+    void writeJson(const TestConfig& config) {
+        std::ofstream file(jsonPath, std::ios::trunc);
+        Utils::Config::JsonConfigParser<TestConfig>().writeConfig(config, file);
+    }
+
+    struct SourceDigest {
+        explicit SourceDigest(const std::filesystem::path& path) {
+            const Utils::Config::MappedFile file(path);
+            hash = Utils::Config::hashConfigSource(file.view());
+            size = file.view().size();
+        }
+
+        uint64_t hash = 0;
+        uint64_t size = 0;
+    };
+
+    TestConfig testConfig;
+    std::filesystem::path jsonPath;
+};
+
+TEST_F(testBeveConfigParser, WriteAndReadConfig) {
+    Utils::Config::BeveConfigParser<TestConfig> parser;
+    std::stringstream stream;
+
+    ASSERT_EQ(parser.writeConfig(testConfig, stream), 0);
+    auto readConfig = parser.readConfig(stream);
+
+    ASSERT_NE(readConfig, nullptr);
+    EXPECT_EQ(readConfig->name, "beve_test");
+    EXPECT_EQ(readConfig->value, 321);
+    EXPECT_DOUBLE_EQ(readConfig->rate, 0.5);
+    EXPECT_TRUE(readConfig->enabled);
+}
+
+TEST_F(testBeveConfigParser, ReadInvalidBeve) {
+    Utils::Config::BeveConfigParser<TestConfig> parser;
+
+    EXPECT_EQ(parser.readConfig(std::string_view("not beve at all")), nullptr);
+}
+
+TEST_F(testBeveConfigParser, HashDetectsChanges) {
+    EXPECT_EQ(Utils::Config::hashConfigSource("{\"value\": 1}"), Utils::Config::hashConfigSource("{\"value\": 1}"));
+    EXPECT_NE(Utils::Config::hashConfigSource("{\"value\": 1}"), Utils::Config::hashConfigSource("{\"value\": 2}"));
+    EXPECT_NE(Utils::Config::hashConfigSource(std::string(64, 'a')),
+              Utils::Config::hashConfigSource(std::string(63, 'a') + "b"));
+}
+
+TEST_F(testBeveConfigParser, CachedParserWritesAndUsesSnapshot) {
+    Utils::Config::CachedConfigParser<TestConfig> parser;
+    const auto snapshotPath = Utils::Config::snapshotPathFor(jsonPath);
+    ASSERT_FALSE(std::filesystem::exists(snapshotPath));
+
+    auto first = parser.readConfigFile(jsonPath);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first->name, "beve_test");
+    ASSERT_TRUE(std::filesystem::exists(snapshotPath));
+
+    // Swap the snapshot's payload while keeping the JSON's hash and size, only a snapshot read can return it
+    const SourceDigest json(jsonPath);
+    ASSERT_EQ(parser.writeSnapshot(*createTestConfig("from_snapshot", 654, 0.5, true), json.hash, json.size,
+                                   snapshotPath),
+              0);
+
+    auto second = parser.readConfigFile(jsonPath);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->name, "from_snapshot");
+    EXPECT_EQ(second->value, 654);
+}
+
+TEST_F(testBeveConfigParser, CachedParserRebuildsSnapshotOfOtherSchema) {
+    Utils::Config::CachedConfigParser<TestConfig> parser;
+    const auto snapshotPath = Utils::Config::snapshotPathFor(jsonPath);
+    const SourceDigest json(jsonPath);
+    ASSERT_EQ(parser.writeSnapshot(*createTestConfig("from_snapshot", 654, 0.5, true), json.hash, json.size,
+                                   snapshotPath),
+              0);
+
+    // Same source JSON, but written by a config type with a different layout
+    {
+        std::fstream snapshot(snapshotPath, std::ios::binary | std::ios::in | std::ios::out);
+        const uint64_t otherFingerprint = 0;
+        snapshot.seekp(offsetof(Utils::Config::ConfigSnapshotHeader, schemaFingerprint));
+        snapshot.write(reinterpret_cast<const char*>(&otherFingerprint), sizeof(otherFingerprint));
+    }
+
+    auto config = parser.readConfigFile(jsonPath);
+    ASSERT_NE(config, nullptr);
+    EXPECT_EQ(config->name, "beve_test");
+    EXPECT_EQ(config->value, 321);
+
+    // The rebuilt snapshot carries the current fingerprint again
+    EXPECT_NE(parser.readSnapshot(snapshotPath, json.hash, json.size), nullptr);
+}
+
+TEST_F(testBeveConfigParser, ConcurrentSnapshotWritesLeaveNoTemporaryFiles) {
+    Utils::Config::CachedConfigParser<TestConfig> parser;
+    const auto snapshotPath = Utils::Config::snapshotPathFor(jsonPath);
+    const SourceDigest json(jsonPath);
+    {
+        std::vector<std::jthread> writers;
+        for (int i = 0; i < 8; ++i) {
+            writers.emplace_back([&] {
+                for (int j = 0; j < 20; ++j) {
+                    EXPECT_EQ(parser.writeSnapshot(testConfig, json.hash, json.size, snapshotPath), 0);
+                }
+            });
+        }
+    }
+
+    std::size_t leftovers = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(jsonPath.parent_path())) {
+        if (entry.path().filename().string().starts_with(snapshotPath.filename().string() + ".")) ++leftovers;
+    }
+    EXPECT_EQ(leftovers, 0u);
+    EXPECT_TRUE(std::filesystem::is_regular_file(snapshotPath));
+}
+
+TEST_F(testBeveConfigParser, CachedParserRebuildsStaleSnapshot) {
+    Utils::Config::CachedConfigParser<TestConfig> parser;
+    ASSERT_NE(parser.readConfigFile(jsonPath), nullptr);
+
+    writeJson(*createTestConfig("changed", 7, 0.5, true));
+    auto changed = parser.readConfigFile(jsonPath);
+
+    ASSERT_NE(changed, nullptr);
+    EXPECT_EQ(changed->name, "changed");
+    EXPECT_EQ(changed->value, 7);
+}
+
+TEST_F(testBeveConfigParser, ProviderLoadsConfigFile) {
+    Utils::Config::ConfigPublisher<TestConfig> publisher;
+    Utils::Config::CachedConfigParser<TestConfig> parser;
+
+    EXPECT_TRUE(publisher.loadConfigFile(parser, jsonPath));
+    ASSERT_NE(publisher.getConfig(), nullptr);
+    EXPECT_EQ(publisher.getConfig()->name, "beve_test");
+
+    EXPECT_FALSE(publisher.loadConfigFile(parser, jsonPath.string() + ".missing"));
+    EXPECT_EQ(publisher.getConfig()->name, "beve_test");
+}
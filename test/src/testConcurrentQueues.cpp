@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Concurrency/BlockingQueue.h"
+#include "Concurrency/MPMCQueue.h"
+#include "Concurrency/MPSCQueue.h"
+#include "Concurrency/SPSCQueue.h"
+
+using Utils::Concurrency::BlockingQueue;
+using Utils::Concurrency::MPMCQueue;
+using Utils::Concurrency::MPSCQueue;
+using Utils::Concurrency::SPSCQueue;
+
+namespace {
+
+// Producer id in the upper half, per-producer sequence in the lower half
+constexpr uint64_t encode(uint64_t producer, uint64_t sequence) { return producer << 32 | sequence; }
+constexpr uint64_t producerOf(uint64_t item) { return item >> 32; }
+constexpr uint64_t sequenceOf(uint64_t item) { return item & 0xffffffffu; }
+
+template <typename Queue, typename Value>
+void pushSpinning(Queue& queue, Value value) {
+    while (!queue.tryPush(value)) std::this_thread::yield();
+}
+
+template <typename Queue>
+uint64_t popSpinning(Queue& queue) {
+    uint64_t value = 0;
+    while (!queue.tryPop(value)) std::this_thread::yield();
+    return value;
+}
+
+}  // namespace
+
+template <typename Queue>
+class testConcurrentQueue : public ::testing::Test {};
+
+using QueueTypes = ::testing::Types<SPSCQueue<std::string>, MPSCQueue<std::string>, MPMCQueue<std::string>>;
+TYPED_TEST_SUITE(testConcurrentQueue, QueueTypes);
+
+TYPED_TEST(testConcurrentQueue, CapacityIsRoundedUpToPowerOfTwo) {
+    EXPECT_EQ(TypeParam(5).capacity(), 8u);
+    EXPECT_EQ(TypeParam(8).capacity(), 8u);
+    EXPECT_EQ(TypeParam(1).capacity(), 2u);
+}
+
+TYPED_TEST(testConcurrentQueue, PushAndPopKeepFifoOrder) {
+    TypeParam queue(4);
+    std::string value;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryPop(value));
+
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(queue.tryPush("item" + std::to_string(i)));
+    EXPECT_FALSE(queue.tryPush("overflow"));
+    EXPECT_EQ(queue.size(), 4u);
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, "item" + std::to_string(i));
+    }
+    EXPECT_FALSE(queue.tryPop(value));
+    EXPECT_TRUE(queue.empty());
+}
+
+TYPED_TEST(testConcurrentQueue, WrapsAroundManyTimes) {
+    TypeParam queue(2);
+    std::string value;
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(queue.tryEmplace(3, static_cast<char>('a' + i % 26)));
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, std::string(3, static_cast<char>('a' + i % 26)));
+    }
+}
+
+TEST(testConcurrentQueues, RemainingElementsAreDestroyed) {
+    auto tracked = std::make_shared<int>(0);
+    {
+        SPSCQueue<std::shared_ptr<int>> spsc(4);
+        MPMCQueue<std::shared_ptr<int>> mpmc(4);
+        spsc.tryPush(tracked);
+        spsc.tryPush(tracked);
+        mpmc.tryPush(tracked);
+        EXPECT_EQ(tracked.use_count(), 4);
+    }
+    EXPECT_EQ(tracked.use_count(), 1);
+}
+
+TEST(testConcurrentQueues, SPSCStressKeepsOrder) {
+    constexpr uint64_t itemCount = 200'000;
+    SPSCQueue<uint64_t> queue(64);
+
+    std::jthread producer([&] {
+        for (uint64_t i = 0; i < itemCount; ++i) pushSpinning(queue, i);
+    });
+
+    for (uint64_t i = 0; i < itemCount; ++i) {
+        ASSERT_EQ(popSpinning(queue), i);
+    }
+}
+
+TEST(testConcurrentQueues, MPSCStressKeepsPerProducerOrder) {
+    constexpr uint64_t producerCount = 4;
+    constexpr uint64_t itemsPerProducer = 50'000;
+    MPSCQueue<uint64_t> queue(64);
+
+    std::vector<std::jthread> producers;
+    for (uint64_t p = 0; p < producerCount; ++p) {
+        producers.emplace_back([&, p] {
+            for (uint64_t i = 0; i < itemsPerProducer; ++i) pushSpinning(queue, encode(p, i));
+        });
+    }
+
+    std::vector<uint64_t> nextSequence(producerCount, 0);
+    for (uint64_t i = 0; i < producerCount * itemsPerProducer; ++i) {
+        const auto item = popSpinning(queue);
+        ASSERT_LT(producerOf(item), producerCount);
+        ASSERT_EQ(sequenceOf(item), nextSequence[producerOf(item)]++);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(testConcurrentQueues, MPMCStressDeliversEveryItemOnce) {
+    constexpr uint64_t threadCount = 4;
+    constexpr uint64_t itemsPerProducer = 50'000;
+    MPMCQueue<uint64_t> queue(64);
+
+    std::vector<std::vector<uint64_t>> received(threadCount);
+    {
+        std::vector<std::jthread> threads;
+        for (uint64_t t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&, t] {
+                for (uint64_t i = 0; i < itemsPerProducer; ++i) pushSpinning(queue, encode(t, i));
+            });
+            threads.emplace_back([&, t] {
+                received[t].reserve(itemsPerProducer);
+                for (uint64_t i = 0; i < itemsPerProducer; ++i) received[t].push_back(popSpinning(queue));
+            });
+        }
+    }
+
+    std::vector<std::vector<bool>> seen(threadCount, std::vector<bool>(itemsPerProducer, false));
+    for (const auto& consumed : received) {
+        // Items of one producer have to stay ordered within what a single consumer saw
+        std::vector<int64_t> lastSequence(threadCount, -1);
+        for (const auto item : consumed) {
+            const auto producer = producerOf(item);
+            const auto sequence = static_cast<int64_t>(sequenceOf(item));
+            ASSERT_LT(producer, threadCount);
+            EXPECT_GT(sequence, lastSequence[producer]);
+            lastSequence[producer] = sequence;
+            EXPECT_FALSE(seen[producer][sequence]);
+            seen[producer][sequence] = true;
+        }
+    }
+    for (const auto& flags : seen) {
+        EXPECT_EQ(static_cast<uint64_t>(std::ranges::count(flags, true)), itemsPerProducer);
+    }
+}
+
+TEST(testConcurrentQueues, BlockingQueueWakesSleepingThreads) {
+    constexpr uint64_t producerCount = 3;
+    constexpr uint64_t itemsPerProducer = 20'000;
+    // Tiny capacity so that both sides regularly end up waiting on each other
+    BlockingQueue<MPMCQueue<uint64_t>> queue(2);
+
+    std::atomic<uint64_t> sum{0};
+    {
+        std::vector<std::jthread> threads;
+        for (uint64_t p = 0; p < producerCount; ++p) {
+            threads.emplace_back([&] {
+                for (uint64_t i = 1; i <= itemsPerProducer; ++i) queue.push(i);
+            });
+            threads.emplace_back([&] {
+                uint64_t local = 0;
+                for (uint64_t i = 0; i < itemsPerProducer; ++i) local += queue.pop();
+                sum.fetch_add(local);
+            });
+        }
+    }
+
+    EXPECT_EQ(sum.load(), producerCount * itemsPerProducer * (itemsPerProducer + 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(testConcurrentQueues, BlockingPopWaitsForPush) {
+    BlockingQueue<SPSCQueue<uint64_t>> queue(4);
+    std::atomic<bool> popped{false};
+
+    std::jthread consumer([&] {
+        EXPECT_EQ(queue.pop(), 42u);
+        popped = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(popped);
+    queue.push(42);
+    consumer.join();
+    EXPECT_TRUE(popped);
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Config/ConfigDirectoryLoader.h"
+#include "Config/ConfigManagers.h"
+#include "Mocks.h"
+
+namespace {
+
+struct LoaderLimits {
+    int connections = 1;
+    int requests = 1;
+};
+
+struct NestedLoaderConfig {
+    std::string name = "default";
+    LoaderLimits limits;
+    std::map<std::string, LoaderLimits> perHost;
+    std::vector<int> ports = {80};
+};
+
+}  // namespace
+
+class testConfigDirectoryLoader : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() / "testConfigDirectoryLoader";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    void writeFile(const std::string& name, std::string_view content) {
+        std::ofstream(directory / name) << content;
+    }
+
+    std::filesystem::path directory;
+};
+
+TEST_F(testConfigDirectoryLoader, ListsJsonFilesByPrecedence) {
+    writeFile("99-overrides.json", "{}");
+    writeFile("00-defaults.json", "{}");
+    writeFile("notes.txt", "ignored");
+    writeFile("10-module.json", "{}");
+
+    const auto files = Utils::Config::ConfigDirectoryLoader<TestConfig>::listConfigFiles(directory);
+
+    ASSERT_EQ(files.size(), 3u);
+    EXPECT_EQ(files[0].filename(), "00-defaults.json");
+    EXPECT_EQ(files[1].filename(), "10-module.json");
+    EXPECT_EQ(files[2].filename(), "99-overrides.json");
+}
+
+TEST_F(testConfigDirectoryLoader, MergesFilesInPrecedenceOrder) {
+    writeFile("00-defaults.json", R"({"name": "defaults", "value": 1, "rate": 1.5, "enabled": false})");
+    writeFile("10-module.json", R"({"value": 2})");
+    writeFile("99-overrides.json", R"({"name": "override"})");
+
+    auto config = Utils::Config::ConfigDirectoryLoader<TestConfig>(2).load(directory);
+
+    ASSERT_NE(config, nullptr);
+    EXPECT_EQ(config->name, "override");
+    EXPECT_EQ(config->value, 2);
+    EXPECT_DOUBLE_EQ(config->rate, 1.5);
+    EXPECT_FALSE(config->enabled);
+}
+
+TEST_F(testConfigDirectoryLoader, PublishesOnce) {
+    for (int i = 0; i < 20; ++i) {
+        writeFile("file_" + std::to_string(10 + i) + ".json", R"({"value": )" + std::to_string(i) + "}");
+    }
+    Utils::Config::ConfigPublisher<TestConfig> publisher;
+    MockConfigSubscriber subscriber;
+
+    EXPECT_TRUE(Utils::Config::ConfigDirectoryLoader<TestConfig>().loadInto(publisher, directory));
+
+    EXPECT_EQ(subscriber.updateCount, 1);
+    ASSERT_NE(publisher.getConfig(), nullptr);
+    EXPECT_EQ(publisher.getConfig()->value, 19);
+}
+
+TEST_F(testConfigDirectoryLoader, MalformedFileFailsWithoutPublishing) {
+    writeFile("00-defaults.json", R"({"name": "defaults"})");
+    writeFile("10-broken.json", R"({"value": )");
+    Utils::Config::ConfigPublisher<TestConfig> publisher;
+    MockConfigSubscriber subscriber;
+
+    EXPECT_FALSE(Utils::Config::ConfigDirectoryLoader<TestConfig>().loadInto(publisher, directory));
+
+    EXPECT_EQ(subscriber.updateCount, 0);
+    EXPECT_EQ(publisher.getConfig(), nullptr);
+}
+
+TEST_F(testConfigDirectoryLoader, MissingDirectoryFailsWithoutPublishing) {
+    Utils::Config::ConfigPublisher<TestConfig> publisher;
+    MockConfigSubscriber subscriber;
+    const auto missing = directory / "missing";
+
+    EXPECT_TRUE(Utils::Config::ConfigDirectoryLoader<TestConfig>::listConfigFiles(missing).empty());
+    EXPECT_EQ(Utils::Config::ConfigDirectoryLoader<TestConfig>().load(missing), nullptr);
+    EXPECT_FALSE(Utils::Config::ConfigDirectoryLoader<TestConfig>().loadInto(publisher, missing));
+
+    EXPECT_EQ(subscriber.updateCount, 0);
+    EXPECT_EQ(publisher.getConfig(), nullptr);
+}
+
+TEST_F(testConfigDirectoryLoader, DirectoryWithoutJsonFilesFailsWithoutPublishing) {
+    writeFile("notes.txt", "ignored");
+    Utils::Config::ConfigPublisher<TestConfig> publisher;
+    MockConfigSubscriber subscriber;
+
+    EXPECT_EQ(Utils::Config::ConfigDirectoryLoader<TestConfig>().load(directory), nullptr);
+    EXPECT_FALSE(Utils::Config::ConfigDirectoryLoader<TestConfig>().loadInto(publisher, directory));
+
+    EXPECT_EQ(subscriber.updateCount, 0);
+    EXPECT_EQ(publisher.getConfig(), nullptr);
+}
+
+TEST_F(testConfigDirectoryLoader, MergesNestedObjectsKeyByKey) {
+    writeFile("00-defaults.json",
+              R"({"name": "defaults", "limits": {"connections": 4, "requests": 8},)"
+              R"( "perHost": {"a": {"connections": 1, "requests": 2}}, "ports": [1, 2]})");
+    writeFile("10-module.json", R"({"limits": {"requests": 16}, "perHost": {"a": {"requests": 3}, "b": {}}})");
+    writeFile("99-overrides.json", R"({"ports": [3]})");
+
+    auto config = Utils::Config::ConfigDirectoryLoader<NestedLoaderConfig>(2).load(directory);
+
+    ASSERT_NE(config, nullptr);
+    EXPECT_EQ(config->name, "defaults");
+    EXPECT_EQ(config->limits.connections, 4);
+    EXPECT_EQ(config->limits.requests, 16);
+    ASSERT_EQ(config->perHost.size(), 2u);
+    EXPECT_EQ(config->perHost["a"].connections, 1);
+    EXPECT_EQ(config->perHost["a"].requests, 3);
+    EXPECT_EQ(config->perHost["b"].connections, 1);
+    EXPECT_EQ(config->ports, std::vector<int>{3});
+}
+
+TEST_F(testConfigDirectoryLoader, LoaderReusesItsPoolAcrossLoads) {
+    writeFile("00-defaults.json", R"({"name": "defaults", "value": 1})");
+    writeFile("10-module.json", R"({"value": 2})");
+    const Utils::Config::ConfigDirectoryLoader<TestConfig> loader(4);
+
+    for (int i = 0; i < 3; ++i) {
+        auto config = loader.load(directory);
+        ASSERT_NE(config, nullptr);
+        EXPECT_EQ(config->value, 2);
+    }
+}
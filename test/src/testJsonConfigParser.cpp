@@ -1,9 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <sstream>
+#include <string>
+#include <string_view>
 
 #include "Config/ConfigParser/JsonConfigParser.h"
+#include "Config/ConfigParser/StreamBuffer.h"
 #include "Mocks.h"
 
 // Note: Since glaze reflection is commented out, these tests will focus on
@@ -91,3 +96,77 @@ TEST_F(testJsonConfigParser, ReadPartialJson) {
     EXPECT_DOUBLE_EQ(readConfig->rate, 3.14);  // default value
     EXPECT_TRUE(readConfig->enabled);          // default value
 }
+
+TEST_F(testJsonConfigParser, ReadFromStringView) {
+    auto parser = std::make_unique<Utils::Config::JsonConfigParser<TestConfig>>();
+    // Deliberately not null terminated right after the document
+    constexpr std::string_view buffer = R"({"name": "view", "value": 7}trailing)";
+    const std::string_view json = buffer.substr(0, buffer.find("trailing"));
+
+    auto readConfig = parser->readConfig(json);
+
+    ASSERT_NE(readConfig, nullptr);
+    EXPECT_EQ(readConfig->name, "view");
+    EXPECT_EQ(readConfig->value, 7);
+    EXPECT_DOUBLE_EQ(readConfig->rate, 3.14);  // default value
+}
+
+TEST_F(testJsonConfigParser, ReadInvalidStringView) {
+    auto parser = std::make_unique<Utils::Config::JsonConfigParser<TestConfig>>();
+
+    EXPECT_EQ(parser->readConfig(std::string_view("{invalid json}")), nullptr);
+    EXPECT_EQ(parser->readConfig(std::string_view()), nullptr);
+}
+
+TEST_F(testJsonConfigParser, ReadConfigFile) {
+    auto parser = std::make_unique<Utils::Config::JsonConfigParser<TestConfig>>();
+    const auto path = std::filesystem::temp_directory_path() / "testJsonConfigParser_ReadConfigFile.json";
+    {
+        std::ofstream file(path);
+        ASSERT_EQ(parser->writeConfig(testConfig, file), 0);
+    }
+
+    auto readConfig = parser->readConfigFile(path);
+    std::filesystem::remove(path);
+
+    ASSERT_NE(readConfig, nullptr);
+    EXPECT_EQ(readConfig->name, "json_test");
+    EXPECT_EQ(readConfig->value, 123);
+    EXPECT_DOUBLE_EQ(readConfig->rate, 1.618);
+    EXPECT_TRUE(readConfig->enabled);
+}
+
+TEST_F(testJsonConfigParser, ReadMissingConfigFile) {
+    auto parser = std::make_unique<Utils::Config::JsonConfigParser<TestConfig>>();
+
+    const auto path = std::filesystem::temp_directory_path() / "testJsonConfigParser_missing.json";
+
+    auto readConfig = parser->readConfigFile(path);
+
+    EXPECT_EQ(readConfig, nullptr);
+}
+
+TEST_F(testJsonConfigParser, RepeatedStreamReadsReuseBuffer) {
+    auto parser = std::make_unique<Utils::Config::JsonConfigParser<TestConfig>>();
+
+    std::stringstream large(R"({"name": ")" + std::string(200000, 'x') + R"(", "value": 1})");
+    auto first = parser->readConfig(large);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first->name.size(), 200000u);
+
+    // A shorter document must not see leftovers of the previous, larger one
+    std::stringstream small(R"({"name": "small"})");
+    auto second = parser->readConfig(small);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->name, "small");
+}
+
+TEST(testStreamBuffer, GivesBackMemoryOfUnusuallyLargeReads) {
+    std::stringstream huge(std::string(8 * 1024 * 1024, 'x'));
+    EXPECT_EQ(Utils::Config::readStreamBuffer(huge).size(), 8u * 1024 * 1024);
+
+    std::stringstream small("{}");
+    const auto& buffer = Utils::Config::readStreamBuffer(small);
+    EXPECT_EQ(buffer, "{}");
+    EXPECT_LT(buffer.capacity(), 8u * 1024 * 1024);
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Config/ConfigParser/JsonIndex.h"
+#include "Config/ConfigParser/LazyConfigView.h"
+#include "Mocks.h"
+
+namespace {
+
+struct LevelsConfig {
+    std::string root = "info";
+    int verbosity = 0;
+};
+
+constexpr std::string_view document = R"({
+    "service": {"name": "lazy", "value": 5, "rate": 0.25, "enabled": false},
+    "logging": {"levels": {"root": "debug", "verbosity": 3}, "sinks": ["console", "file"]},
+    "odd/key": {"tilde~key": "escaped"},
+    "text": "braces } ] { [ and \"quotes\" inside",
+    "numbers": [1, 2.5, -3e2, true, null]
+})";
+
+}  // namespace
+
+TEST(testJsonIndex, FindsNestedValues) {
+    Utils::Config::JsonIndex index(document);
+
+    EXPECT_EQ(index.find("/logging/levels/verbosity"), "3");
+    EXPECT_EQ(index.find("/logging/sinks/1"), "\"file\"");
+    EXPECT_EQ(index.find("/service/name"), "\"lazy\"");
+    EXPECT_EQ(index.find("/numbers/2"), "-3e2");
+    EXPECT_EQ(index.find("/numbers/4"), "null");
+    EXPECT_EQ(index.find("/text"), R"("braces } ] { [ and \"quotes\" inside")");
+    EXPECT_EQ(index.find("/logging/levels"), R"({"root": "debug", "verbosity": 3})");
+}
+
+TEST(testJsonIndex, RootPointerIsWholeDocument) {
+    Utils::Config::JsonIndex index("  [1, 2]\n");
+
+    EXPECT_EQ(index.find(""), "[1, 2]");
+    EXPECT_EQ(index.find("/1"), "2");
+}
+
+TEST(testJsonIndex, EscapedTokens) {
+    Utils::Config::JsonIndex index(document);
+
+    EXPECT_EQ(index.find("/odd~1key/tilde~0key"), "\"escaped\"");
+    EXPECT_EQ(Utils::Config::JsonIndex::escapeToken("a/b~c"), "a~1b~0c");
+}
+
+TEST(testJsonIndex, MissingValues) {
+    Utils::Config::JsonIndex index(document);
+
+    EXPECT_FALSE(index.find("/missing"));
+    EXPECT_FALSE(index.find("/logging/sinks/2"));
+    EXPECT_FALSE(index.find("/service/name/deeper"));
+    EXPECT_FALSE(index.find("no-leading-slash"));
+}
+
+TEST(testJsonIndex, MalformedDocument) {
+    Utils::Config::JsonIndex truncated(R"({"a": {"b": 1})");
+    EXPECT_FALSE(truncated.find(""));
+    EXPECT_FALSE(truncated.find("/a/b"));
+
+    Utils::Config::JsonIndex missingColon(R"({"a" 1})");
+    EXPECT_FALSE(missingColon.find("/a"));
+}
+
+TEST(testJsonIndex, KeysInDocumentOrder) {
+    Utils::Config::JsonIndex index(document);
+
+    EXPECT_EQ(index.keys(""), (std::vector<std::string>{"service", "logging", "odd~1key", "text", "numbers"}));
+    EXPECT_EQ(index.keys("/logging/sinks"), (std::vector<std::string>{"0", "1"}));
+    EXPECT_FALSE(index.keys("/text"));
+}
+
+TEST(testJsonIndex, DuplicateKeysUseLastValue) {
+    Utils::Config::JsonIndex index(R"({"a": 1, "b": 2, "a": 3})");
+
+    EXPECT_EQ(index.find("/a"), "3");
+    EXPECT_EQ(index.keys(""), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(testLazyConfigView, ParsesOnlyRequestedSubTree) {
+    Utils::Config::LazyConfigView view{std::string(document)};
+
+    auto levels = view.get<LevelsConfig>("/logging/levels");
+    ASSERT_NE(levels, nullptr);
+    EXPECT_EQ(levels->root, "debug");
+    EXPECT_EQ(levels->verbosity, 3);
+    EXPECT_EQ(view.getCachedCount(), 1u);
+
+    auto service = view.get<TestConfig>("/service");
+    ASSERT_NE(service, nullptr);
+    EXPECT_EQ(service->name, "lazy");
+    EXPECT_EQ(service->value, 5);
+    EXPECT_FALSE(service->enabled);
+}
+
+TEST(testLazyConfigView, CachesParsedValues) {
+    Utils::Config::LazyConfigView view{std::string(document)};
+
+    auto first = view.get<LevelsConfig>("/logging/levels");
+    auto second = view.get<LevelsConfig>("/logging/levels");
+
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(view.getCachedCount(), 1u);
+}
+
+TEST(testLazyConfigView, MissingOrMismatchedValue) {
+    Utils::Config::LazyConfigView view{std::string(document)};
+
+    EXPECT_EQ(view.get<LevelsConfig>("/logging/missing"), nullptr);
+    EXPECT_EQ(view.get<LevelsConfig>("/logging/sinks"), nullptr);
+    EXPECT_EQ(view.getCachedCount(), 0u);
+    EXPECT_TRUE(view.contains("/logging/sinks"));
+}
+
+TEST(testLazyConfigView, ConcurrentReadersShareInstance) {
+    Utils::Config::LazyConfigView view{std::string(document)};
+    std::vector<std::shared_ptr<const LevelsConfig>> results(8);
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&, i] { results[i] = view.get<LevelsConfig>("/logging/levels"); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_NE(results[0], nullptr);
+    for (const auto& result : results) {
+        EXPECT_EQ(result, results[0]);
+    }
+}
+
+TEST(testLazyConfigView, FromFile) {
+    const auto path = std::filesystem::temp_directory_path() / "testLazyConfigView.json";
+    std::ofstream(path) << document;
+
+    auto view = Utils::Config::LazyConfigView::fromFile(path);
+    ASSERT_NE(view, nullptr);
+    EXPECT_EQ(view->raw("/service/value"), "5");
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(Utils::Config::LazyConfigView::fromFile(path), nullptr);
+}
@@ -1,7 +1,19 @@
 #include <gtest/gtest.h>
 #include <spdlog/fmt/fmt.h>
+#include <spdlog/details/os.h>
 #include <spdlog/sinks/base_sink.h>
 
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "Logging/Logger.h"
 #include "Logging/LoggerMacros.h"
 
@@ -101,3 +113,191 @@ TEST_F(LoggerTest, LogLevelFiltering) {
     EXPECT_FALSE(testSink->log_contents.find("Debug message") != std::string::npos);
     EXPECT_TRUE(testSink->log_contents.find("Info message") != std::string::npos);
 }
+
+class RecordingSink : public spdlog::sinks::base_sink<std::mutex> {
+   public:
+    struct Entry {
+        spdlog::log_clock::time_point time;
+        size_t threadId;
+        std::string payload;
+    };
+
+    std::vector<Entry> entries;
+
+    size_t count() {
+        std::lock_guard lock(mutex_);
+        return entries.size();
+    }
+
+   protected:
+    void sink_it_(const spdlog::details::log_msg& msg) override {
+        entries.push_back({msg.time, msg.thread_id, std::string(msg.payload.data(), msg.payload.size())});
+    }
+    void flush_() override {}
+};
+
+class BatchedLoggerTest : public ::testing::Test {
+   protected:
+    static std::shared_ptr<LoggerConfig> createTestConfig() {
+        auto c = std::make_shared<LoggerConfig>();
+        c->filename = "test_log.txt";
+        c->batching = true;
+        c->batchSize = 16;
+        // Long enough that only full buffers and flush() move records in these tests
+        c->batchFlushIntervalMs = 60'000;
+        return c;
+    }
+
+    BatchedLoggerTest() : m_logger("BatchedLogger", createTestConfig()), sink(std::make_shared<RecordingSink>()) {
+        m_logger.clearSinks();
+        m_logger.addSink(sink);
+    }
+
+    Logger m_logger;
+    std::shared_ptr<RecordingSink> sink;
+};
+
+TEST_F(BatchedLoggerTest, FlushWritesStagedRecords) {
+    LOG_D("Filtered before staging");
+    LOG_I("Staged {}", 1);
+    LOG_W("Staged {}", 2);
+
+    m_logger.flush();
+    ASSERT_EQ(sink->entries.size(), 2u);
+    EXPECT_EQ(sink->entries[0].payload, "Staged 1");
+    EXPECT_EQ(sink->entries[1].payload, "Staged 2");
+}
+
+TEST_F(BatchedLoggerTest, KeepsPerThreadOrderAndThreadIds) {
+    constexpr int threadCount = 4;
+    constexpr int messagesPerThread = 2000;
+
+    std::vector<size_t> threadIds(threadCount);
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&, t] {
+                threadIds[t] = spdlog::details::os::thread_id();
+                for (int i = 0; i < messagesPerThread; ++i) LOG_I("{} {}", t, i);
+            });
+        }
+    }
+    m_logger.flush();
+
+    ASSERT_EQ(sink->entries.size(), static_cast<size_t>(threadCount * messagesPerThread));
+    std::vector<int> nextMessage(threadCount, 0);
+    for (const auto& entry : sink->entries) {
+        int thread = -1;
+        int message = -1;
+        ASSERT_EQ(std::sscanf(entry.payload.c_str(), "%d %d", &thread, &message), 2);
+        ASSERT_GE(thread, 0);
+        ASSERT_LT(thread, threadCount);
+        EXPECT_EQ(entry.threadId, threadIds[thread]);
+        EXPECT_EQ(message, nextMessage[thread]++);
+    }
+}
+
+TEST_F(BatchedLoggerTest, MergesBatchesByTimestamp) {
+    // Buffers large enough that everything is drained at once by flush()
+    auto config = createTestConfig();
+    config->batchSize = 4096;
+    Logger mergingLogger("MergingLogger", config);
+    auto recording = std::make_shared<RecordingSink>();
+    mergingLogger.clearSinks();
+    mergingLogger.addSink(recording);
+
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < 1000; ++i) mergingLogger.log<LogLevel::INFO>(fmt::format("{} {}", t, i));
+            });
+        }
+    }
+    mergingLogger.flush();
+
+    ASSERT_EQ(recording->entries.size(), 4000u);
+    const auto outOfOrder = std::ranges::adjacent_find(
+        recording->entries, [](const auto& lhs, const auto& rhs) { return rhs.time < lhs.time; });
+    EXPECT_EQ(outOfOrder, recording->entries.end());
+}
+
+TEST_F(BatchedLoggerTest, FlushIntervalBoundsLatency) {
+    auto config = createTestConfig();
+    config->batchFlushIntervalMs = 5;
+    Logger intervalLogger("IntervalLogger", config);
+    auto recording = std::make_shared<RecordingSink>();
+    intervalLogger.clearSinks();
+    intervalLogger.addSink(recording);
+
+    intervalLogger.log<LogLevel::INFO>("Written without flush");
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (recording->count() == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_EQ(recording->count(), 1u);
+    EXPECT_EQ(recording->entries[0].payload, "Written without flush");
+}
+
+TEST_F(BatchedLoggerTest, KeepsTimestampOrderAcrossDrains) {
+    // Small rings and a short interval, so the writer drains many times while the producers are still logging
+    auto config = createTestConfig();
+    config->batchFlushIntervalMs = 1;
+    Logger drainingLogger("DrainingLogger", config);
+    auto recording = std::make_shared<RecordingSink>();
+    drainingLogger.clearSinks();
+    drainingLogger.addSink(recording);
+
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < 2000; ++i) {
+                    drainingLogger.log<LogLevel::INFO>(fmt::format("{} {}", t, i));
+                    if (i % 64 == 0) std::this_thread::yield();
+                }
+            });
+        }
+    }
+    drainingLogger.flush();
+
+    ASSERT_EQ(recording->entries.size(), 8000u);
+    const auto outOfOrder = std::ranges::adjacent_find(
+        recording->entries, [](const auto& lhs, const auto& rhs) { return rhs.time < lhs.time; });
+    EXPECT_EQ(outOfOrder, recording->entries.end());
+}
+
+TEST_F(BatchedLoggerTest, ErrorsAreWrittenSynchronously) {
+    LOG_I("Staged before the error");
+    LOG_E("Written right away");
+
+    ASSERT_EQ(sink->count(), 2u);
+    EXPECT_EQ(sink->entries[0].payload, "Staged before the error");
+    EXPECT_EQ(sink->entries[1].payload, "Written right away");
+}
+
+TEST(BatchedLoggerSignalTest, SignalFlushesStagedRecordsBeforeTerminating) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    const auto logFile = std::filesystem::temp_directory_path() / "utils_batched_signal_test.txt";
+    std::filesystem::remove(logFile);
+
+    EXPECT_EXIT(
+        {
+            auto config = std::make_shared<LoggerConfig>();
+            config->filename = logFile.string();
+            config->batching = true;
+            config->batchFlushIntervalMs = 60'000;
+            Logger m_logger("SignalLogger", config);
+            LOG_I("Staged before the signal");
+            std::raise(SIGTERM);
+            // The watcher thread flushes and terminates the process with the signal's default action
+            for (;;) std::this_thread::sleep_for(std::chrono::seconds(1));
+        },
+        testing::KilledBySignal(SIGTERM), "");
+
+    std::ifstream file(logFile);
+    const std::string contents{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    EXPECT_NE(contents.find("Staged before the signal"), std::string::npos);
+    std::filesystem::remove(logFile);
+}
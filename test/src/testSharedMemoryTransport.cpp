@@ -0,0 +1,450 @@
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Concurrency/SharedMemoryChannel.h"
+#include "PublishSubscribe/SharedMemoryBridge.h"
+
+using Utils::Concurrency::SharedMemoryChannel;
+using Utils::Concurrency::SharedMemoryChannelOptions;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+std::string channelName(const std::string& test) { return "UtilsTest." + test + "." + std::to_string(getpid()); }
+
+std::span<const std::byte> bytesOf(const uint64_t& value) { return std::as_bytes(std::span(&value, 1)); }
+
+uint64_t valueOf(const SharedMemoryChannel::Message& message) {
+    uint64_t value = 0;
+    std::memcpy(&value, message.payload.data(), sizeof(value));
+    return value;
+}
+
+template <typename Predicate>
+bool waitFor(Predicate&& predicate, std::chrono::milliseconds timeout = 5s) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() >= deadline) return false;
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST(testSharedMemoryTransport, EveryReaderSeesMessagesWrittenAfterItSubscribed) {
+    auto channel = SharedMemoryChannel::create(channelName("Broadcast"), {.slotCount = 8, .slotSize = 64});
+    ASSERT_TRUE(channel);
+
+    ASSERT_TRUE(channel->write(bytesOf(1)));
+    auto first = channel->subscribe();
+    auto second = channel->subscribe();
+    ASSERT_TRUE(first && second);
+
+    for (uint64_t value = 2; value <= 4; ++value) ASSERT_TRUE(channel->write(bytesOf(value)));
+    for (auto* reader : {first.get(), second.get()}) {
+        for (uint64_t value = 2; value <= 4; ++value) {
+            const auto message = reader->read(1s);
+            ASSERT_TRUE(message);
+            EXPECT_EQ(valueOf(*message), value);
+            EXPECT_EQ(message->origin, channel->getOriginId());
+        }
+        EXPECT_FALSE(reader->read(10ms));
+    }
+}
+
+TEST(testSharedMemoryTransport, RejectsMessagesLargerThanASlot) {
+    auto channel = SharedMemoryChannel::create(channelName("Oversized"), {.slotCount = 4, .slotSize = 16});
+    ASSERT_TRUE(channel);
+
+    const std::vector<std::byte> payload(17);
+    EXPECT_FALSE(channel->write(payload));
+}
+
+TEST(testSharedMemoryTransport, OpenFailsForMissingChannel) {
+    EXPECT_EQ(SharedMemoryChannel::open(channelName("Missing"), 10ms), nullptr);
+}
+
+TEST(testSharedMemoryTransport, SlowReaderBlocksWriterInsteadOfLosingMessages) {
+    const auto name = channelName("BackPressure");
+    auto channel = SharedMemoryChannel::create(name, {.slotCount = 4, .slotSize = 16});
+    auto attached = SharedMemoryChannel::open(name);
+    ASSERT_TRUE(channel && attached);
+    auto reader = attached->subscribe();
+
+    constexpr uint64_t messageCount = 2000;
+    std::jthread writer([&] {
+        for (uint64_t value = 0; value < messageCount; ++value) ASSERT_TRUE(channel->write(bytesOf(value)));
+    });
+
+    for (uint64_t value = 0; value < messageCount; ++value) {
+        const auto message = reader->read(5s);
+        ASSERT_TRUE(message);
+        ASSERT_EQ(valueOf(*message), value);
+        if (value % 256 == 0) std::this_thread::sleep_for(1ms);
+    }
+}
+
+TEST(testSharedMemoryTransport, ReachesReaderInAnotherProcess) {
+    const auto name = channelName("CrossProcess");
+    auto channel = SharedMemoryChannel::create(name, {.slotCount = 16, .slotSize = 16});
+    ASSERT_TRUE(channel);
+    auto reader = channel->subscribe();
+
+    constexpr uint64_t messageCount = 1000;
+    const pid_t child = fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        auto attached = SharedMemoryChannel::open(name);
+        bool written = attached != nullptr;
+        for (uint64_t value = 0; written && value < messageCount; ++value) written = attached->write(bytesOf(value));
+        _exit(written ? 0 : 1);
+    }
+
+    for (uint64_t value = 0; value < messageCount; ++value) {
+        const auto message = reader->read(5s);
+        ASSERT_TRUE(message);
+        EXPECT_EQ(valueOf(*message), value);
+        EXPECT_NE(message->origin, channel->getOriginId());
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+namespace {
+
+// Forks a writer that crashes between claiming a slot and committing it: its payload cannot be read
+void crashWhileWriting(const std::string& name) {
+    const pid_t child = fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        auto attached = SharedMemoryChannel::open(name);
+        void* unreadable = mmap(nullptr, 4096, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (!attached || unreadable == MAP_FAILED) _exit(1);
+        attached->write(std::span(static_cast<const std::byte*>(unreadable), sizeof(uint64_t)));
+        _exit(0);
+    }
+
+    // Killed by SIGSEGV, or exited with an error code when a sanitizer caught it
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFSIGNALED(status) || (WIFEXITED(status) && WEXITSTATUS(status) > 1));
+}
+
+// Forks a process that leaves the channel without cleaning up, with its reader place still taken
+void dieWhileSubscribed(const std::string& name) {
+    const pid_t child = fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        auto attached = SharedMemoryChannel::open(name);
+        auto reader = attached ? attached->subscribe() : nullptr;
+        _exit(reader ? 0 : 1);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+}  // namespace
+
+TEST(testSharedMemoryTransport, ReadersSkipMessagesOfDeadWriters) {
+    const auto name = channelName("DeadWriterReader");
+    auto channel = SharedMemoryChannel::create(name, {.slotCount = 2, .slotSize = 16});
+    ASSERT_TRUE(channel);
+    auto reader = channel->subscribe();
+    ASSERT_TRUE(reader);
+
+    crashWhileWriting(name);
+    ASSERT_TRUE(channel->write(bytesOf(1)));
+    for (uint64_t value = 1; value <= 4; ++value) {
+        const auto message = reader->read(1s);
+        ASSERT_TRUE(message);
+        EXPECT_EQ(valueOf(*message), value);
+        if (value < 4) {
+            ASSERT_TRUE(channel->write(bytesOf(value + 1)));
+        }
+    }
+}
+
+TEST(testSharedMemoryTransport, WritersReuseSlotsOfDeadWriters) {
+    const auto name = channelName("DeadWriterWriter");
+    auto channel = SharedMemoryChannel::create(name, {.slotCount = 2, .slotSize = 16});
+    ASSERT_TRUE(channel);
+
+    crashWhileWriting(name);
+    // The third write needs the crashed writer's slot again
+    for (uint64_t value = 0; value < 3; ++value) ASSERT_TRUE(channel->write(bytesOf(value)));
+}
+
+TEST(testSharedMemoryTransport, CreateRefusesLiveChannelAndReplacesStaleOne) {
+    const auto name = channelName("Replace");
+    auto channel = SharedMemoryChannel::create(name, {.slotCount = 4, .slotSize = 16});
+    ASSERT_TRUE(channel);
+    EXPECT_EQ(SharedMemoryChannel::create(name, {.slotCount = 4, .slotSize = 16}), nullptr);
+    channel.reset();
+
+    // A creator that died without cleaning up leaves its segment behind
+    const pid_t child = fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) _exit(SharedMemoryChannel::create(name, {.slotCount = 4, .slotSize = 16}).release() ? 0 : 1);
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    EXPECT_TRUE(SharedMemoryChannel::create(name, {.slotCount = 4, .slotSize = 16}));
+}
+
+TEST(testSharedMemoryTransport, OwnerOnlyUnlinksItsOwnSegment) {
+    const auto name = channelName("Unlink");
+    auto first = SharedMemoryChannel::create(name, {.slotCount = 4, .slotSize = 16});
+    ASSERT_TRUE(first);
+    shm_unlink(first->getName().c_str());
+    auto second = SharedMemoryChannel::create(name, {.slotCount = 4, .slotSize = 16});
+    ASSERT_TRUE(second);
+
+    first.reset();
+    EXPECT_TRUE(SharedMemoryChannel::open(name, 10ms));
+}
+
+TEST(testSharedMemoryTransport, SubscribeReclaimsPlacesOfDeadReaders) {
+    const auto name = channelName("DeadReader");
+    auto channel = SharedMemoryChannel::create(name, {.slotCount = 4, .slotSize = 16, .maxReaders = 1});
+    ASSERT_TRUE(channel);
+
+    dieWhileSubscribed(name);
+    EXPECT_TRUE(channel->subscribe());
+}
+
+namespace {
+
+struct PodMessage {
+    uint64_t sequence = 0;
+    double value = 0.0;
+};
+
+struct NamedMessage {
+    std::string name;
+    int value = 0;
+};
+
+template <typename Message>
+class RecordingSubscriber : public Utils::PublishSubscribe::ISubscriber<Message> {
+   public:
+    void onUpdate(const Message& message) override {
+        std::lock_guard lock(m_mutex);
+        m_received.push_back(message);
+    }
+
+    std::vector<Message> received() {
+        std::lock_guard lock(m_mutex);
+        return m_received;
+    }
+
+   private:
+    std::mutex m_mutex;
+    std::vector<Message> m_received;
+};
+
+template <typename Message>
+class AddressRecordingSubscriber : public Utils::PublishSubscribe::ISubscriber<Message> {
+   public:
+    void onUpdate(const Message& message) override { address = &message; }
+
+    std::atomic<const Message*> address{nullptr};
+};
+
+template <typename Message>
+class TestPublisher : public Utils::PublishSubscribe::IPublisher<Message> {
+   public:
+    void send(const Message& message) { this->publish(message); }
+};
+
+}  // namespace
+
+TEST(testSharedMemoryTransport, BridgeDoesNotEchoReceivedMessages) {
+    // Two handles of one channel in one process behave like two processes, both deliver to the same manager
+    const auto name = channelName("BridgeEcho");
+    std::shared_ptr<SharedMemoryChannel> outbound =
+        SharedMemoryChannel::create(name, {.slotCount = 16, .slotSize = 64});
+    std::shared_ptr<SharedMemoryChannel> inbound = SharedMemoryChannel::open(name);
+    ASSERT_TRUE(outbound && inbound);
+
+    RecordingSubscriber<PodMessage> subscriber;
+    Utils::PublishSubscribe::SharedMemoryBridge<PodMessage> sender(outbound, true, false);
+    Utils::PublishSubscribe::SharedMemoryBridge<PodMessage> receiver(inbound, true, true);
+    TestPublisher<PodMessage> publisher;
+
+    publisher.send({1, 0.5});
+    // Once locally, once through the channel; an echo would keep it circulating
+    ASSERT_TRUE(waitFor([&] { return subscriber.received().size() >= 2; }));
+    std::this_thread::sleep_for(50ms);
+
+    const auto received = subscriber.received();
+    ASSERT_EQ(received.size(), 2u);
+    for (const auto& message : received) {
+        EXPECT_EQ(message.sequence, 1u);
+        EXPECT_DOUBLE_EQ(message.value, 0.5);
+    }
+}
+
+TEST(testSharedMemoryTransport, BridgeDeliversPublishesOfAnotherProcess) {
+    const auto name = channelName("BridgeCrossProcess");
+    std::shared_ptr<SharedMemoryChannel> channel =
+        SharedMemoryChannel::create(name, {.slotCount = 16, .slotSize = 64});
+    ASSERT_TRUE(channel);
+
+    RecordingSubscriber<PodMessage> subscriber;
+    Utils::PublishSubscribe::SharedMemoryBridge<PodMessage> bridge(channel, false, true);
+
+    constexpr uint64_t messageCount = 100;
+    const pid_t child = fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        std::shared_ptr<SharedMemoryChannel> attached = SharedMemoryChannel::open(name);
+        if (!attached) _exit(1);
+        Utils::PublishSubscribe::SharedMemoryBridge<PodMessage> childBridge(attached, true, false);
+        TestPublisher<PodMessage> publisher;
+        for (uint64_t i = 0; i < messageCount; ++i) publisher.send({i, static_cast<double>(i)});
+        _exit(0);
+    }
+
+    ASSERT_TRUE(waitFor([&] { return subscriber.received().size() >= messageCount; }));
+    const auto received = subscriber.received();
+    ASSERT_EQ(received.size(), messageCount);
+    for (uint64_t i = 0; i < messageCount; ++i) EXPECT_EQ(received[i].sequence, i);
+
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+TEST(testSharedMemoryTransport, BridgeDeliversRawMessagesFromTheirSlot) {
+    const auto name = channelName("BridgeInPlace");
+    std::shared_ptr<SharedMemoryChannel> outbound =
+        SharedMemoryChannel::create(name, {.slotCount = 16, .slotSize = 64});
+    std::shared_ptr<SharedMemoryChannel> inbound = SharedMemoryChannel::open(name);
+    ASSERT_TRUE(outbound && inbound);
+
+    AddressRecordingSubscriber<PodMessage> subscriber;
+    Utils::PublishSubscribe::SharedMemoryBridge<PodMessage> receiver(inbound, false, true);
+    auto reader = inbound->subscribe();
+    ASSERT_TRUE(reader);
+
+    const PodMessage message{3, 1.5};
+    ASSERT_TRUE(outbound->write(std::as_bytes(std::span(&message, 1))));
+    const auto slot = reader->read(1s);
+    ASSERT_TRUE(slot);
+    ASSERT_TRUE(waitFor([&] { return subscriber.address.load() != nullptr; }));
+    EXPECT_EQ(static_cast<const void*>(subscriber.address.load()), static_cast<const void*>(slot->payload.data()));
+}
+
+TEST(testSharedMemoryTransport, BridgeStaysUnsubscribedWhenItCannotConnect) {
+    std::shared_ptr<SharedMemoryChannel> channel =
+        SharedMemoryChannel::create(channelName("BridgeTooSmall"), {.slotCount = 4, .slotSize = sizeof(PodMessage) / 2});
+    ASSERT_TRUE(channel);
+    auto* manager = Utils::PublishSubscribe::PublishSubscribeManager<PodMessage>::getManager();
+    const auto subscribers = manager->getSubscriberCount();
+
+    Utils::PublishSubscribe::SharedMemoryBridge<PodMessage> bridge(channel);
+    EXPECT_FALSE(bridge.isConnected());
+    EXPECT_EQ(manager->getSubscriberCount(), subscribers);
+}
+
+TEST(testSharedMemoryTransport, BridgeSerializesNonTrivialMessages) {
+    const auto name = channelName("BridgeBeve");
+    std::shared_ptr<SharedMemoryChannel> outbound =
+        SharedMemoryChannel::create(name, {.slotCount = 16, .slotSize = 256});
+    std::shared_ptr<SharedMemoryChannel> inbound = SharedMemoryChannel::open(name);
+    ASSERT_TRUE(outbound && inbound);
+
+    RecordingSubscriber<NamedMessage> subscriber;
+    Utils::PublishSubscribe::SharedMemoryBridge<NamedMessage> sender(outbound, true, false);
+    Utils::PublishSubscribe::SharedMemoryBridge<NamedMessage> receiver(inbound, false, true);
+    TestPublisher<NamedMessage> publisher;
+
+    publisher.send({"serialized", 7});
+    ASSERT_TRUE(waitFor([&] { return subscriber.received().size() >= 2; }));
+
+    const auto received = subscriber.received();
+    EXPECT_EQ(received.back().name, "serialized");
+    EXPECT_EQ(received.back().value, 7);
+}
+
+namespace {
+
+// Republishes every message that arrives through the bridge one depth further, which goes back out through the bridge
+class ChainingSubscriber : public Utils::PublishSubscribe::ISubscriber<PodMessage>,
+                           public Utils::PublishSubscribe::IPublisher<PodMessage> {
+   public:
+    static constexpr uint64_t maxDepth = 20;
+
+    void onUpdate(const PodMessage& message) override {
+        // Our own republish reaches us locally as well
+        if (m_republishing) return;
+        {
+            std::lock_guard lock(m_mutex);
+            m_received.push_back(message.sequence);
+        }
+        waitFor([this] { return started.load(); });
+
+        if (message.sequence < maxDepth) {
+            m_republishing = true;
+            publish({message.sequence + 1, message.value});
+            m_republishing = false;
+        }
+    }
+
+    std::vector<uint64_t> received() {
+        std::lock_guard lock(m_mutex);
+        return m_received;
+    }
+
+    std::atomic<bool> started{false};
+
+   private:
+    bool m_republishing = false;
+    std::mutex m_mutex;
+    std::vector<uint64_t> m_received;
+};
+
+}  // namespace
+
+TEST(testSharedMemoryTransport, BridgeSubscribersMayPublishFromCallbacks) {
+    const auto name = channelName("BridgeRepublish");
+    std::shared_ptr<SharedMemoryChannel> outbound = SharedMemoryChannel::create(name, {.slotCount = 2, .slotSize = 64});
+    std::shared_ptr<SharedMemoryChannel> inbound = SharedMemoryChannel::open(name);
+    ASSERT_TRUE(outbound && inbound);
+
+    ChainingSubscriber subscriber;
+    Utils::PublishSubscribe::SharedMemoryBridge<PodMessage> sender(outbound, true, false);
+    Utils::PublishSubscribe::SharedMemoryBridge<PodMessage> receiver(inbound, false, true);
+
+    // Both slots are taken once the first callback republishes: one by the message being delivered, one by the next
+    const PodMessage start{0, 1.0};
+    ASSERT_TRUE(outbound->write(std::as_bytes(std::span(&start, 1))));
+    ASSERT_TRUE(outbound->write(std::as_bytes(std::span(&start, 1))));
+    subscriber.started = true;
+
+    constexpr auto expected = 2 * (ChainingSubscriber::maxDepth + 1);
+    ASSERT_TRUE(waitFor([&] { return subscriber.received().size() >= expected; }));
+    const auto received = subscriber.received();
+    EXPECT_EQ(received.size(), expected);
+    EXPECT_EQ(std::count(received.begin(), received.end(), ChainingSubscriber::maxDepth), 2);
+}
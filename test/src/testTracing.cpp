@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Logging/Logger.h"
+#include "Logging/Tracing.h"
+#include "Logging/TracingMacros.h"
+
+using namespace Utils::Logging;
+
+namespace {
+
+std::optional<SpanSummary> findSummary(const std::vector<SpanSummary>& summaries, const std::string& name) {
+    const auto it = std::find_if(summaries.begin(), summaries.end(), [&](const auto& s) { return s.name == name; });
+    if (it == summaries.end()) return std::nullopt;
+    return *it;
+}
+
+void tracedSleep() {
+    TRACE_SCOPE("testTracing.sleep");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+}
+
+void tracedFunction() { TRACE_FUNCTION(); }
+
+// Destroyed after the thread's trace state was handed back, so its span goes to the shared late state
+struct TracesOnExit {
+    ~TracesOnExit() { tracedFunction(); }
+};
+
+}  // namespace
+
+class testTracing : public ::testing::Test {
+   protected:
+    void SetUp() override {
+#ifdef UTILS_TRACING_DISABLED
+        GTEST_SKIP() << "spans are compiled out with UTILS_ENABLE_TRACING=OFF";
+#endif
+    }
+};
+
+TEST_F(testTracing, ScopedTimerRecordsDurations) {
+    Tracer::collect();
+    for (int i = 0; i < 3; ++i) {
+        tracedSleep();
+    }
+
+    const auto summary = findSummary(Tracer::collect(), "testTracing.sleep");
+    ASSERT_TRUE(summary);
+    EXPECT_EQ(summary->count, 3u);
+    EXPECT_GE(summary->meanNs, 1.5e6);
+    EXPECT_GE(summary->p99Ns, summary->p50Ns);
+    EXPECT_GE(summary->maxNs, 1.5e6);
+
+    // collect() only reports what happened since the previous call
+    EXPECT_FALSE(findSummary(Tracer::collect(), "testTracing.sleep"));
+}
+
+TEST_F(testTracing, FunctionSpansAcrossThreads) {
+    Tracer::collect();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([] {
+            for (int j = 0; j < 250; ++j) {
+                tracedFunction();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto summary = findSummary(Tracer::collect(), "tracedFunction");
+    ASSERT_TRUE(summary);
+    EXPECT_EQ(summary->count, 1000u);
+}
+
+TEST_F(testTracing, RecyclesStatesOfExitedThreads) {
+    Tracer::collect();
+    // Warm up so a state is free for reuse before measuring
+    std::thread(tracedFunction).join();
+    const auto statesBefore = Tracer::threadStateCount();
+
+    for (int i = 0; i < 64; ++i) {
+        std::thread([] {
+            for (int j = 0; j < 10; ++j) {
+                tracedFunction();
+            }
+        }).join();
+    }
+
+    EXPECT_EQ(Tracer::threadStateCount(), statesBefore);
+    // Spans of exited threads are kept in the summaries
+    const auto summary = findSummary(Tracer::collect(), "tracedFunction");
+    ASSERT_TRUE(summary);
+    EXPECT_EQ(summary->count, 641u);
+}
+
+TEST_F(testTracing, CountsSpansOfExitingThreads) {
+    Tracer::collect();
+    {
+        std::vector<std::jthread> threads;
+        for (int i = 0; i < 8; ++i) {
+            threads.emplace_back([] {
+                // Constructed before the first span, so destroyed after the thread's state was retired
+                static thread_local TracesOnExit tracesOnExit;
+                static_cast<void>(&tracesOnExit);
+                for (int j = 0; j < 10; ++j) {
+                    tracedFunction();
+                }
+            });
+        }
+    }
+
+    const auto summary = findSummary(Tracer::collect(), "tracedFunction");
+    ASSERT_TRUE(summary);
+    EXPECT_EQ(summary->count, 88u);
+}
+
+TEST_F(testTracing, ReportLogsSummaries) {
+    std::ostringstream output;
+    Logger logger("TracingLogger");
+    logger.clearSinks();
+    logger.addSink(std::make_shared<spdlog::sinks::ostream_sink_mt>(output));
+
+    tracedSleep();
+    Tracer::report(logger);
+    logger.flush();
+
+    EXPECT_NE(output.str().find("[trace] testTracing.sleep: count=1"), std::string::npos);
+}
+
+TEST_F(testTracing, BackgroundReporting) {
+    std::ostringstream output;
+    Logger logger("TracingReporter");
+    logger.clearSinks();
+    logger.addSink(std::make_shared<spdlog::sinks::ostream_sink_mt>(output));
+
+    Tracer::collect();
+    Tracer::startReporting(logger, std::chrono::milliseconds(5));
+    tracedSleep();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    Tracer::stopReporting();
+    logger.flush();
+
+    EXPECT_NE(output.str().find("testTracing.sleep"), std::string::npos);
+}
+
+TEST_F(testTracing, WritesChromeTrace) {
+    const auto path = std::filesystem::temp_directory_path() / "testTracing.trace.json";
+    Tracer::enableTraceEvents(1024);
+    tracedSleep();
+    Tracer::disableTraceEvents();
+
+    ASSERT_TRUE(Tracer::writeChromeTrace(path));
+    std::ifstream file(path);
+    const std::string trace((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(trace.find(R"("name":"testTracing.sleep","ph":"X")"), std::string::npos);
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Config/VersionedConfigPublisher.h"
+#include "Mocks.h"
+
+class testVersionedConfigPublisher : public ::testing::Test {
+   protected:
+    void SetUp() override { publisher = std::make_unique<Utils::Config::VersionedConfigPublisher<TestConfig>>(4); }
+
+    std::unique_ptr<Utils::Config::VersionedConfigPublisher<TestConfig>> publisher;
+};
+
+TEST_F(testVersionedConfigPublisher, VersionsIncreaseMonotonically) {
+    EXPECT_EQ(publisher->getCurrentVersion(), 0u);
+    EXPECT_EQ(publisher->getConfig(), nullptr);
+    EXPECT_FALSE(publisher->pin());
+
+    for (int i = 1; i <= 3; ++i) {
+        publisher->setConfig(createTestConfig("v" + std::to_string(i), i));
+        EXPECT_EQ(publisher->getCurrentVersion(), static_cast<uint64_t>(i));
+        EXPECT_EQ(publisher->getLatestVersion(), static_cast<uint64_t>(i));
+    }
+    EXPECT_EQ(publisher->getConfig()->name, "v3");
+}
+
+TEST_F(testVersionedConfigPublisher, PinnedSnapshotSurvivesUpdates) {
+    publisher->setConfig(createTestConfig("pinned", 1));
+    const auto snapshot = publisher->pin();
+
+    // Push the pinned version out of the history ring
+    for (int i = 2; i <= 10; ++i) {
+        publisher->setConfig(createTestConfig("newer", i));
+    }
+
+    ASSERT_TRUE(snapshot);
+    EXPECT_EQ(snapshot.getVersion(), 1u);
+    EXPECT_EQ(snapshot->name, "pinned");
+    EXPECT_EQ((*snapshot).value, 1);
+    EXPECT_FALSE(publisher->getSnapshot(1));
+}
+
+TEST_F(testVersionedConfigPublisher, RollbackRepublishes) {
+    MockConfigSubscriber subscriber;
+    publisher->setConfig(createTestConfig("good", 1));
+    publisher->setConfig(createTestConfig("bad", 2));
+    EXPECT_EQ(subscriber.updateCount, 2);
+
+    EXPECT_TRUE(publisher->rollback(1));
+
+    EXPECT_EQ(publisher->getCurrentVersion(), 1u);
+    EXPECT_EQ(publisher->getLatestVersion(), 2u);
+    EXPECT_EQ(publisher->getConfig()->name, "good");
+    EXPECT_EQ(subscriber.updateCount, 3);
+    ASSERT_NE(subscriber.lastReceivedConfig, nullptr);
+    EXPECT_EQ(subscriber.lastReceivedConfig->name, "good");
+
+    // Versions keep counting from the latest one after a rollback
+    publisher->setConfig(createTestConfig("fixed", 3));
+    EXPECT_EQ(publisher->getCurrentVersion(), 3u);
+}
+
+TEST_F(testVersionedConfigPublisher, RollbackToUnknownVersionFails) {
+    MockConfigSubscriber subscriber;
+    for (int i = 1; i <= 6; ++i) {
+        publisher->setConfig(createTestConfig("config", i));
+    }
+    const int updates = subscriber.updateCount;
+
+    EXPECT_FALSE(publisher->rollback(0));
+    EXPECT_FALSE(publisher->rollback(2));  // evicted, history holds 3..6
+    EXPECT_FALSE(publisher->rollback(7));  // not published yet
+    EXPECT_TRUE(publisher->rollback(3));
+
+    EXPECT_EQ(subscriber.updateCount, updates + 1);
+    EXPECT_EQ(publisher->getConfig()->value, 3);
+}
+
+TEST_F(testVersionedConfigPublisher, EvictedUnpinnedConfigsAreFreed) {
+    auto config = createTestConfig("short lived", 1);
+    std::weak_ptr<TestConfig> weak = config;
+    publisher->setConfig(std::move(config));
+
+    {
+        const auto snapshot = publisher->pin();
+        for (int i = 2; i <= 5; ++i) {
+            publisher->setConfig(createTestConfig("newer", i));
+        }
+        EXPECT_FALSE(weak.expired());
+    }
+
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST_F(testVersionedConfigPublisher, ConcurrentReadersSeeConsistentSnapshots) {
+    std::atomic<bool> done{false};
+    std::atomic<int> inconsistent{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                const auto snapshot = publisher->pin();
+                if (snapshot && static_cast<uint64_t>(snapshot->value) != snapshot.getVersion()) {
+                    inconsistent.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (int i = 1; i <= 1000; ++i) {
+        publisher->setConfig(createTestConfig("concurrent", i));
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(inconsistent.load(), 0);
+    EXPECT_EQ(publisher->getCurrentVersion(), 1000u);
+}
+
+namespace {
+
+// Checks that every published config is the current one at the time and that versions only move forward
+class OrderCheckingSubscriber : public Utils::PublishSubscribe::ISubscriber<std::shared_ptr<TestConfig>> {
+   public:
+    explicit OrderCheckingSubscriber(const Utils::Config::VersionedConfigPublisher<TestConfig>& publisher)
+        : m_publisher(publisher) {}
+
+    void onUpdate(const std::shared_ptr<TestConfig>& config) override {
+        const auto current = m_publisher.pin();
+        if (current.getConfig() != config || current.getVersion() <= m_lastVersion) outOfOrder.fetch_add(1);
+        m_lastVersion = current.getVersion();
+        received.fetch_add(1);
+    }
+
+    std::atomic<int> outOfOrder{0};
+    std::atomic<int> received{0};
+
+   private:
+    const Utils::Config::VersionedConfigPublisher<TestConfig>& m_publisher;
+    uint64_t m_lastVersion = 0;
+};
+
+}  // namespace
+
+TEST_F(testVersionedConfigPublisher, ConcurrentUpdatesArePublishedInVersionOrder) {
+    OrderCheckingSubscriber subscriber(*publisher);
+
+    constexpr int writerCount = 4;
+    constexpr int updatesPerWriter = 250;
+    {
+        std::vector<std::jthread> writers;
+        for (int w = 0; w < writerCount; ++w) {
+            writers.emplace_back([&] {
+                for (int i = 0; i < updatesPerWriter; ++i) {
+                    publisher->setConfig(createTestConfig("concurrent", i));
+                }
+            });
+        }
+    }
+
+    EXPECT_EQ(subscriber.received.load(), writerCount * updatesPerWriter);
+    EXPECT_EQ(subscriber.outOfOrder.load(), 0);
+}
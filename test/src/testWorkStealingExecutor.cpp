@@ -0,0 +1,360 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Concurrency/Strand.h"
+#include "Concurrency/WorkStealingDeque.h"
+#include "Concurrency/WorkStealingExecutor.h"
+#include "PublishSubscribe/IPublisherSubscriber.h"
+
+using namespace Utils::Concurrency;
+
+TEST(testWorkStealingExecutor, DequeOwnerPopsLifoThievesStealFifo) {
+    WorkStealingDeque<int> deque(4);
+    for (int i = 1; i <= 4; ++i) EXPECT_TRUE(deque.push(i));
+    EXPECT_FALSE(deque.push(5));
+
+    EXPECT_EQ(deque.steal(), 1);
+    EXPECT_EQ(deque.pop(), 4);
+    EXPECT_EQ(deque.steal(), 2);
+    EXPECT_EQ(deque.pop(), 3);
+    EXPECT_FALSE(deque.pop());
+    EXPECT_FALSE(deque.steal());
+}
+
+TEST(testWorkStealingExecutor, DequeStressHandsOutEveryItemOnce) {
+    constexpr int itemCount = 100'000;
+    WorkStealingDeque<int> deque(256);
+    std::vector<std::atomic<int>> taken(itemCount);
+
+    std::atomic<bool> producing{true};
+    std::vector<std::jthread> thieves;
+    for (int t = 0; t < 3; ++t) {
+        thieves.emplace_back([&] {
+            while (producing || !deque.empty()) {
+                if (const auto item = deque.steal()) taken[*item].fetch_add(1);
+            }
+        });
+    }
+
+    for (int i = 0; i < itemCount; ++i) {
+        while (!deque.push(i)) {
+            if (const auto item = deque.pop()) taken[*item].fetch_add(1);
+        }
+    }
+    while (const auto item = deque.pop()) taken[*item].fetch_add(1);
+    producing = false;
+    thieves.clear();
+
+    for (int i = 0; i < itemCount; ++i) ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+}
+
+TEST(testWorkStealingExecutor, RunsAllTasksIncludingNestedOnes) {
+    WorkStealingExecutor executor(ExecutorOptions{.threadCount = 4});
+    std::atomic<int> executed{0};
+    TaskGroup group;
+
+    for (int i = 0; i < 100; ++i) {
+        executor.submit(group, [&] {
+            ++executed;
+            for (int j = 0; j < 10; ++j) executor.submit(group, [&] { ++executed; });
+        });
+    }
+    executor.wait(group);
+
+    EXPECT_TRUE(group.done());
+    EXPECT_EQ(executed.load(), 1100);
+}
+
+TEST(testWorkStealingExecutor, WaitInsideTaskHelpsInsteadOfBlocking) {
+    // A single worker: the nested wait can only finish by running the inner tasks itself
+    WorkStealingExecutor executor(ExecutorOptions{.threadCount = 1});
+    std::atomic<int> executed{0};
+    TaskGroup outer;
+
+    executor.submit(outer, [&] {
+        TaskGroup inner;
+        for (int i = 0; i < 10; ++i) executor.submit(inner, [&] { ++executed; });
+        executor.wait(inner);
+        EXPECT_EQ(executed.load(), 10);
+    });
+    executor.wait(outer);
+    EXPECT_EQ(executed.load(), 10);
+}
+
+TEST(testWorkStealingExecutor, FullQueuesRunTasksOnSubmitter) {
+    WorkStealingExecutor executor(ExecutorOptions{.threadCount = 1, .queueCapacity = 2});
+    std::atomic<int> executed{0};
+    TaskGroup group;
+
+    for (int i = 0; i < 1000; ++i) executor.submit(group, [&] { ++executed; });
+    executor.wait(group);
+    EXPECT_EQ(executed.load(), 1000);
+}
+
+TEST(testWorkStealingExecutor, PinnedWorkersStillRunTasks) {
+    WorkStealingExecutor executor(ExecutorOptions{.threadCount = 2, .cpuSets = {{0}}});
+    std::atomic<int> executed{0};
+    TaskGroup group;
+
+    for (int i = 0; i < 100; ++i) executor.submit(group, [&] { ++executed; });
+    executor.wait(group);
+    EXPECT_EQ(executed.load(), 100);
+}
+
+TEST(testWorkStealingExecutor, InvalidCpuSetsLeaveWorkersUnpinned) {
+    WorkStealingExecutor executor(ExecutorOptions{.threadCount = 2, .cpuSets = {{-1}, {0, 1 << 20}}});
+    std::atomic<int> executed{0};
+    TaskGroup group;
+
+    for (int i = 0; i < 100; ++i) executor.submit(group, [&] { ++executed; });
+    executor.wait(group);
+    EXPECT_EQ(executed.load(), 100);
+}
+
+TEST(testWorkStealingExecutor, StrandOutlivesItsOwnerWhileDraining) {
+    WorkStealingExecutor executor(ExecutorOptions{.threadCount = 2});
+    std::atomic<int> executed{0};
+    {
+        auto strand = std::make_shared<Strand>(executor);
+        for (int i = 0; i < 1000; ++i) strand->post([&] { ++executed; });
+    }
+
+    TaskGroup group;
+    executor.submit(group, [] {});
+    while (executed.load() != 1000) executor.wait(group);
+    EXPECT_EQ(executed.load(), 1000);
+}
+
+TEST(testWorkStealingExecutor, StrandRunsTasksInOrderWithoutOverlap) {
+    WorkStealingExecutor executor(ExecutorOptions{.threadCount = 4});
+    auto strand = std::make_shared<Strand>(executor);
+    std::vector<int> order;
+    std::atomic<int> running{0};
+    std::atomic<bool> overlapped{false};
+    TaskGroup group;
+
+    for (int i = 0; i < 1000; ++i) {
+        strand->post(group, [&, i] {
+            if (running.fetch_add(1) != 0) overlapped = true;
+            order.push_back(i);
+            running.fetch_sub(1);
+        });
+    }
+    executor.wait(group);
+
+    EXPECT_FALSE(overlapped);
+    ASSERT_EQ(order.size(), 1000u);
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(order[i], i);
+}
+
+TEST(testWorkStealingExecutor, WaitRethrowsExceptionsOfItsGroup) {
+    WorkStealingExecutor executor(ExecutorOptions{.threadCount = 2});
+    std::atomic<int> executed{0};
+    TaskGroup group;
+
+    for (int i = 0; i < 100; ++i) {
+        executor.submit(group, [&, i] {
+            if (i == 50) throw std::runtime_error("task failed");
+            ++executed;
+        });
+    }
+    EXPECT_THROW(executor.wait(group), std::runtime_error);
+    EXPECT_EQ(executed.load(), 99);
+
+    // Reported once, the group can be reused afterwards
+    executor.submit(group, [&] { ++executed; });
+    EXPECT_NO_THROW(executor.wait(group));
+    EXPECT_EQ(executed.load(), 100);
+}
+
+TEST(testWorkStealingExecutor, ThrowingStrandTasksKeepTheStrandRunning) {
+    WorkStealingExecutor executor(ExecutorOptions{.threadCount = 2});
+    auto strand = std::make_shared<Strand>(executor);
+    std::vector<int> order;
+    TaskGroup group;
+
+    for (int i = 0; i < 100; ++i) {
+        strand->post(group, [&, i] {
+            if (i % 10 == 0) throw std::runtime_error("task failed");
+            order.push_back(i);
+        });
+    }
+    // Ungrouped tasks have nobody to report to, their exceptions are only logged
+    strand->post([] { throw std::runtime_error("ungrouped task failed"); });
+    EXPECT_THROW(executor.wait(group), std::runtime_error);
+    EXPECT_EQ(order.size(), 90u);
+
+    TaskGroup next;
+    strand->post(next, [&] { order.push_back(100); });
+    EXPECT_NO_THROW(executor.wait(next));
+    ASSERT_EQ(order.size(), 91u);
+    EXPECT_EQ(order.back(), 100);
+}
+
+namespace {
+
+struct ExecutorMessage {
+    int publisher = 0;
+    int sequence = 0;
+};
+
+class RecordingSubscriber : public Utils::PublishSubscribe::ISubscriber<ExecutorMessage> {
+   public:
+    void onUpdate(const ExecutorMessage& message) override {
+        if (m_running.fetch_add(1) != 0) overlapped = true;
+        received.push_back(message);
+        m_running.fetch_sub(1);
+    }
+
+    std::vector<ExecutorMessage> received;
+    std::atomic<bool> overlapped{false};
+
+   private:
+    std::atomic<int> m_running{0};
+};
+
+class CountingSubscriber : public Utils::PublishSubscribe::ISubscriber<ExecutorMessage> {
+   public:
+    void onUpdate(const ExecutorMessage&) override { ++received; }
+
+    std::atomic<int> received{0};
+};
+
+class ThrowingSubscriber : public Utils::PublishSubscribe::ISubscriber<ExecutorMessage> {
+   public:
+    void onUpdate(const ExecutorMessage& message) override {
+        if (message.sequence < 0) throw std::runtime_error("rejected message");
+    }
+};
+
+class ExecutorPublisher : public Utils::PublishSubscribe::IPublisher<ExecutorMessage> {
+   public:
+    void send(const ExecutorMessage& message) { publish(message); }
+};
+
+}  // namespace
+
+class testPublishSubscribeExecutor : public ::testing::Test {
+   protected:
+    void TearDown() override { manager->setExecutor(nullptr); }
+
+    Utils::PublishSubscribe::PublishSubscribeManager<ExecutorMessage>* manager =
+        Utils::PublishSubscribe::PublishSubscribeManager<ExecutorMessage>::getManager();
+    std::shared_ptr<WorkStealingExecutor> executor =
+        std::make_shared<WorkStealingExecutor>(ExecutorOptions{.threadCount = 4});
+};
+
+TEST_F(testPublishSubscribeExecutor, PublishReturnsAfterAllSubscribersRan) {
+    std::vector<std::unique_ptr<CountingSubscriber>> subscribers;
+    for (int i = 0; i < 64; ++i) subscribers.push_back(std::make_unique<CountingSubscriber>());
+    manager->setExecutor(executor, false);
+
+    ExecutorPublisher publisher;
+    for (int i = 0; i < 10; ++i) {
+        publisher.send({0, i});
+        for (const auto& subscriber : subscribers) ASSERT_EQ(subscriber->received.load(), i + 1);
+    }
+}
+
+TEST_F(testPublishSubscribeExecutor, PreservesPerSubscriberOrder) {
+    manager->setExecutor(executor);
+    std::vector<std::unique_ptr<RecordingSubscriber>> subscribers;
+    // Subscribers registered after setExecutor() get their strand as well
+    for (int i = 0; i < 8; ++i) subscribers.push_back(std::make_unique<RecordingSubscriber>());
+
+    constexpr int publisherCount = 3;
+    constexpr int messagesPerPublisher = 200;
+    {
+        std::vector<std::jthread> threads;
+        for (int p = 0; p < publisherCount; ++p) {
+            threads.emplace_back([p] {
+                ExecutorPublisher publisher;
+                for (int i = 0; i < messagesPerPublisher; ++i) publisher.send({p, i});
+            });
+        }
+    }
+
+    for (const auto& subscriber : subscribers) {
+        EXPECT_FALSE(subscriber->overlapped);
+        ASSERT_EQ(subscriber->received.size(), static_cast<size_t>(publisherCount * messagesPerPublisher));
+        std::vector<int> next(publisherCount, 0);
+        for (const auto& message : subscriber->received) {
+            EXPECT_EQ(message.sequence, next[message.publisher]++);
+        }
+    }
+}
+
+TEST_F(testPublishSubscribeExecutor, SubscriberExceptionsReachThePublisher) {
+    for (const bool preserveSubscriberOrder : {true, false}) {
+        manager->setExecutor(executor, preserveSubscriberOrder);
+        ThrowingSubscriber throwing;
+        std::vector<std::unique_ptr<CountingSubscriber>> subscribers;
+        for (int i = 0; i < 8; ++i) subscribers.push_back(std::make_unique<CountingSubscriber>());
+
+        ExecutorPublisher publisher;
+        EXPECT_THROW(publisher.send({0, -1}), std::runtime_error);
+        // Everybody else still got the message, and delivery keeps working
+        for (const auto& subscriber : subscribers) EXPECT_EQ(subscriber->received.load(), 1);
+        EXPECT_NO_THROW(publisher.send({0, 1}));
+        for (const auto& subscriber : subscribers) EXPECT_EQ(subscriber->received.load(), 2);
+    }
+}
+
+namespace {
+
+struct NestedMessage {
+    int depth = 0;
+};
+
+// Publishes the next depth from its own callback, so every delivery waits on the other subscriber's strand
+class RepublishingSubscriber : public Utils::PublishSubscribe::ISubscriber<NestedMessage>,
+                               public Utils::PublishSubscribe::IPublisher<NestedMessage> {
+   public:
+    static constexpr int maxDepth = 6;
+
+    void onUpdate(const NestedMessage& message) override {
+        ++received;
+        if (message.depth < maxDepth) publish({message.depth + 1});
+    }
+
+    std::atomic<int> received{0};
+};
+
+class NestedPublisher : public Utils::PublishSubscribe::IPublisher<NestedMessage> {
+   public:
+    void send(const NestedMessage& message) { publish(message); }
+};
+
+}  // namespace
+
+TEST(testPublishSubscribeStrands, SubscribersPublishingFromCallbacksDoNotDeadlock) {
+    auto* manager = Utils::PublishSubscribe::PublishSubscribeManager<NestedMessage>::getManager();
+    manager->setExecutor(std::make_shared<WorkStealingExecutor>(ExecutorOptions{.threadCount = 4}));
+    RepublishingSubscriber first;
+    RepublishingSubscriber second;
+
+    constexpr int publisherCount = 4;
+    constexpr int messagesPerPublisher = 20;
+    {
+        std::vector<std::jthread> threads;
+        for (int p = 0; p < publisherCount; ++p) {
+            threads.emplace_back([] {
+                NestedPublisher publisher;
+                for (int i = 0; i < messagesPerPublisher; ++i) publisher.send({0});
+            });
+        }
+    }
+
+    // Every message at depth d reaches both subscribers, each of which publishes depth d + 1
+    int perMessage = 0;
+    for (int depth = 0; depth <= RepublishingSubscriber::maxDepth; ++depth) perMessage += 1 << depth;
+    EXPECT_EQ(first.received.load(), publisherCount * messagesPerPublisher * perMessage);
+    EXPECT_EQ(second.received.load(), publisherCount * messagesPerPublisher * perMessage);
+    manager->setExecutor(nullptr);
+}